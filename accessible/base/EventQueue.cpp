@@ -11,6 +11,7 @@
 #include "DocAccessibleChild.h"
 #include "nsAccessibilityService.h"
 #include "nsTextEquivUtils.h"
+#include "nsDataHashtable.h"
 #ifdef A11Y_LOG
 #include "Logging.h"
 #endif
@@ -22,6 +23,11 @@ using namespace mozilla::a11y;
 // aren't packed into single selection within event.
 const unsigned int kSelChangeCountToPack = 5;
 
+// Defines the number of events in the queue from which reorder coalescing
+// looks earlier events up in a table of the tail event target's ancestors
+// instead of walking the ancestor chain once per event.
+const unsigned int kReorderCountToHashAncestors = 16;
+
 ////////////////////////////////////////////////////////////////////////////////
 // EventQueue
 ////////////////////////////////////////////////////////////////////////////////
@@ -230,6 +236,20 @@ void
 EventQueue::CoalesceReorderEvents(AccEvent* aTailEvent)
 {
   uint32_t count = mEvents.Length();
+
+  // Ancestors of the tail event target mapped to their child on the path to
+  // it.
+  nsDataHashtable<nsPtrHashKey<Accessible>, Accessible*> tailAncestors;
+  bool useTailAncestors = count > kReorderCountToHashAncestors;
+  if (useTailAncestors) {
+    Accessible* tailParent = aTailEvent->mAccessible;
+    while (tailParent && tailParent != mDocument) {
+      if (tailParent->Parent())
+        tailAncestors.Put(tailParent->Parent(), tailParent);
+      tailParent = tailParent->Parent();
+    }
+  }
+
   for (uint32_t index = count - 2; index < count; index--) {
     AccEvent* thisEvent = mEvents[index];
 
@@ -294,23 +314,33 @@ EventQueue::CoalesceReorderEvents(AccEvent* aTailEvent)
     //   if hide of thisEvent contains the tailEvent
     //   then assert
     //   otherwise ignore tailEvent but not its show and hide events
-    Accessible* tailParent = aTailEvent->mAccessible;
-    while (tailParent && tailParent != mDocument) {
-      if (tailParent->Parent() == thisEvent->mAccessible) {
-        AccReorderEvent* thisReorder = downcast_accEvent(thisEvent);
-        AccReorderEvent* tailReorder = downcast_accEvent(aTailEvent);
-        uint32_t eventType = thisReorder->IsShowHideEventTarget(tailParent);
-        if (eventType == nsIAccessibleEvent::EVENT_SHOW)
-          tailReorder->DoNotEmitAll();
-        else if (eventType == nsIAccessibleEvent::EVENT_HIDE)
-          NS_ERROR("Accessible tree was modified after it was removed! Huh?");
-        else
-          aTailEvent->mEventRule = AccEvent::eDoNotEmit;
+    Accessible* tailParent = nullptr;
+    if (useTailAncestors) {
+      tailParent = tailAncestors.Get(thisEvent->mAccessible);
+    } else {
+      Accessible* parent = aTailEvent->mAccessible;
+      while (parent && parent != mDocument) {
+        if (parent->Parent() == thisEvent->mAccessible) {
+          tailParent = parent;
+          break;
+        }
 
-        return;
+        parent = parent->Parent();
       }
+    }
 
-      tailParent = tailParent->Parent();
+    if (tailParent) {
+      AccReorderEvent* thisReorder = downcast_accEvent(thisEvent);
+      AccReorderEvent* tailReorder = downcast_accEvent(aTailEvent);
+      uint32_t eventType = thisReorder->IsShowHideEventTarget(tailParent);
+      if (eventType == nsIAccessibleEvent::EVENT_SHOW)
+        tailReorder->DoNotEmitAll();
+      else if (eventType == nsIAccessibleEvent::EVENT_HIDE)
+        NS_ERROR("Accessible tree was modified after it was removed! Huh?");
+      else
+        aTailEvent->mEventRule = AccEvent::eDoNotEmit;
+
+      return;
     }
 
   } // for (index)
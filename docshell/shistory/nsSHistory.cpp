@@ -30,6 +30,7 @@
 #include "nsISHTransaction.h"
 #include "nsISHistoryListener.h"
 #include "nsComponentManagerUtils.h"
+#include "nsThreadUtils.h"
 
 // For calculating max history entries and max cachable contentviewers
 #include "prsystem.h"
@@ -202,8 +203,29 @@ GetContentViewerForTransaction(nsISHTransaction* aTrans)
   return viewer.forget();
 }
 
+class DestroyEvictedViewerEvent : public nsRunnable
+{
+public:
+  explicit DestroyEvictedViewerEvent(nsIContentViewer* aViewer)
+    : mViewer(aViewer)
+  {
+  }
+
+  NS_IMETHOD Run()
+  {
+    mViewer->Destroy();
+    return NS_OK;
+  }
+
+private:
+  nsCOMPtr<nsIContentViewer> mViewer;
+};
+
+// If aDestroyAsync is true the evicted viewer is torn down from an event
+// rather than on the caller's stack, which is often the load of the page
+// that pushed the viewer out of the cache.
 void
-EvictContentViewerForTransaction(nsISHTransaction* aTrans)
+EvictContentViewerForTransaction(nsISHTransaction* aTrans, bool aDestroyAsync)
 {
   nsCOMPtr<nsISHEntry> entry;
   aTrans->GetSHEntry(getter_AddRefs(entry));
@@ -223,6 +245,14 @@ EvictContentViewerForTransaction(nsISHTransaction* aTrans)
     // document teardown is able to correctly persist the state.
     ownerEntry->SetContentViewer(nullptr);
     ownerEntry->SyncPresentationState();
+
+    if (aDestroyAsync) {
+      nsCOMPtr<nsIRunnable> evt = new DestroyEvictedViewerEvent(viewer);
+      if (NS_SUCCEEDED(NS_DispatchToCurrentThread(evt))) {
+        return;
+      }
+      NS_WARNING("failed to dispatch DestroyEvictedViewerEvent");
+    }
     viewer->Destroy();
   }
 }
@@ -801,7 +831,7 @@ nsSHistory::EvictAllContentViewers()
   // we might have viewers quite far from mIndex.  So just evict everything.
   nsCOMPtr<nsISHTransaction> trans = mListRoot;
   while (trans) {
-    EvictContentViewerForTransaction(trans);
+    EvictContentViewerForTransaction(trans, false);
 
     nsISHTransaction* temp = trans;
     temp->GetNext(getter_AddRefs(trans));
@@ -989,7 +1019,7 @@ nsSHistory::EvictOutOfRangeWindowContentViewers(int32_t aIndex)
   while (trans) {
     nsCOMPtr<nsIContentViewer> viewer = GetContentViewerForTransaction(trans);
     if (safeViewers.IndexOf(viewer) == -1) {
-      EvictContentViewerForTransaction(trans);
+      EvictContentViewerForTransaction(trans, true);
     }
 
     nsISHTransaction* temp = trans;
@@ -1138,7 +1168,7 @@ nsSHistory::GloballyEvictContentViewers()
 
   for (int32_t i = transactions.Length() - 1; i >= sHistoryMaxTotalViewers;
        --i) {
-    EvictContentViewerForTransaction(transactions[i].mTransaction);
+    EvictContentViewerForTransaction(transactions[i].mTransaction, true);
   }
 }
 
@@ -1172,7 +1202,7 @@ nsSHistory::EvictExpiredContentViewerForEntry(nsIBFCacheEntry* aEntry)
     return NS_OK;
   }
 
-  EvictContentViewerForTransaction(trans);
+  EvictContentViewerForTransaction(trans, true);
 
   return NS_OK;
 }
@@ -75,6 +75,31 @@ GetIndexFromCache(const nsAttrAndChildArray* aArray)
   return indexCache[ix].array == aArray ? indexCache[ix].index : -1;
 }
 
+// Keep a cached index pointing at the same child when children are inserted
+// or removed in front of it, so that IndexOfChild on a list that's being
+// prepended to still hits on its first probe.
+static
+inline
+void
+UpdateIndexCacheForInsert(const nsAttrAndChildArray* aArray, int32_t aPos)
+{
+  uint32_t ix = CACHE_GET_INDEX(aArray);
+  if (indexCache[ix].array == aArray && indexCache[ix].index >= aPos) {
+    ++indexCache[ix].index;
+  }
+}
+
+static
+inline
+void
+UpdateIndexCacheForRemove(const nsAttrAndChildArray* aArray, int32_t aPos)
+{
+  uint32_t ix = CACHE_GET_INDEX(aArray);
+  if (indexCache[ix].array == aArray && indexCache[ix].index > aPos) {
+    --indexCache[ix].index;
+  }
+}
+
 
 /**
  * Due to a compiler bug in VisualAge C++ for AIX, we need to return the 
@@ -149,6 +174,7 @@ nsAttrAndChildArray::InsertChildAt(nsIContent* aChild, uint32_t aPos)
     SetChildAtPos(pos, aChild, aPos, childCount);
 
     SetChildCount(childCount + 1);
+    UpdateIndexCacheForInsert(this, aPos);
 
     return NS_OK;
   }
@@ -166,6 +192,7 @@ nsAttrAndChildArray::InsertChildAt(nsIContent* aChild, uint32_t aPos)
     SetChildAtPos(newStart + aPos, aChild, aPos, childCount);
 
     SetAttrSlotAndChildCount(attrCount, childCount + 1);
+    UpdateIndexCacheForInsert(this, aPos);
 
     return NS_OK;
   }
@@ -182,6 +209,7 @@ nsAttrAndChildArray::InsertChildAt(nsIContent* aChild, uint32_t aPos)
   SetChildAtPos(pos, aChild, aPos, childCount);
 
   SetChildCount(childCount + 1);
+  UpdateIndexCacheForInsert(this, aPos);
   
   return NS_OK;
 }
@@ -212,6 +240,7 @@ nsAttrAndChildArray::TakeChildAt(uint32_t aPos)
 
   memmove(pos, pos + 1, (childCount - aPos - 1) * sizeof(nsIContent*));
   SetChildCount(childCount - 1);
+  UpdateIndexCacheForRemove(this, aPos);
 
   return dont_AddRef(child);
 }
@@ -2584,10 +2584,52 @@ FindMatchingElements(nsINode* aRoot, nsCSSSelectorList* aSelectorList, T &aList,
     return;
   }
 
+  // Similarly, if a compound selector further left has an ID and is only
+  // connected to the rightmost one through descendant and child combinators
+  // (e.g. "#sidebar li.item"), every match has to be a descendant of the
+  // element with that ID, so we only need to walk its subtree.
+  nsINode* walkRoot = aRoot;
+  if (aRoot->IsInDoc() &&
+      doc->GetCompatibilityMode() != eCompatibility_NavQuirks &&
+      !aSelectorList->mNext) {
+    nsIAtom* ancestorId = nullptr;
+    for (nsCSSSelector* sel = aSelectorList->mSelectors->mNext;
+         sel;
+         sel = sel->mNext) {
+      if (sel->mOperator != char16_t(' ') && sel->mOperator != char16_t('>')) {
+        break;
+      }
+      if (sel->mIDList) {
+        ancestorId = sel->mIDList->mAtom;
+        break;
+      }
+    }
+
+    if (ancestorId) {
+      const nsTArray<Element*>* elements =
+        doc->GetAllElementsForId(nsDependentAtomString(ancestorId));
+      if (!elements || elements->IsEmpty()) {
+        // Without that ancestor nothing can match.
+        return;
+      }
+      // With duplicate IDs the subtrees might overlap or come out of
+      // document order; just do the full walk then.
+      if (elements->Length() == 1) {
+        Element* idElement = elements->ElementAt(0);
+        if (nsContentUtils::ContentIsDescendantOf(idElement, aRoot)) {
+          walkRoot = idElement;
+        } else if (!nsContentUtils::ContentIsDescendantOf(aRoot, idElement)) {
+          // The subtrees are disjoint.
+          return;
+        }
+      }
+    }
+  }
+
   Collector results;
-  for (nsIContent* cur = aRoot->GetFirstChild();
+  for (nsIContent* cur = walkRoot->GetFirstChild();
        cur;
-       cur = cur->GetNextNode(aRoot)) {
+       cur = cur->GetNextNode(walkRoot)) {
     if (cur->IsElement() &&
         nsCSSRuleProcessor::SelectorListMatches(cur->AsElement(),
                                                 matchingContext,
@@ -29,6 +29,7 @@
 #include "nsIPrompt.h"
 #include "nsIObserverService.h"
 #include "nsITimer.h"
+#include "nsThreadUtils.h"
 #include "nsIAtom.h"
 #include "nsContentUtils.h"
 #include "mozilla/EventDispatcher.h"
@@ -122,6 +123,10 @@ const size_t gStackSize = 8192;
 // If we haven't painted in 100ms, we allow for a longer GC budget
 #define NS_INTERSLICE_GC_BUDGET     40 // ms
 
+// Maximum amount of time an incremental GC slice waits for the main thread to
+// become idle before it runs anyway
+#define NS_INTERSLICE_GC_IDLE_WAIT  50 // ms
+
 // The amount of time we wait between a request to CC (after GC ran)
 // and doing the actual CC.
 #define NS_CC_DELAY                 6000 // ms
@@ -1810,17 +1815,124 @@ nsJSContext::EndCycleCollectionCallback(CycleCollectorResults &aResults)
   gCCStats.Clear();
 }
 
-// static
-void
-InterSliceGCTimerFired(nsITimer *aTimer, void *aClosure)
+static void
+InterSliceGC()
 {
-  nsJSContext::KillInterSliceGCTimer();
   nsJSContext::GarbageCollectNow(JS::gcreason::INTER_SLICE_GC,
                                  nsJSContext::IncrementalGC,
                                  nsJSContext::NonShrinkingGC,
                                  NS_INTERSLICE_GC_BUDGET);
 }
 
+// Runs the next slice of an incremental GC once the main thread has no
+// other pending event, so that the slice doesn't delay a refresh driver tick
+// or input that was already queued when the inter-slice timer fired.  At most
+// one of these is pending at a time, see sIdleInterSliceGC.
+class IdleInterSliceGCRunnable final : public nsRunnable
+{
+public:
+  IdleInterSliceGCRunnable()
+    : mDispatchTime(TimeStamp::Now())
+    , mCanceled(false)
+  {
+  }
+
+  NS_IMETHOD Run() override;
+
+  // Called when the slice has been run by another route, e.g. by the
+  // fallback timer, or when the inter-slice GC is no longer wanted.
+  void Cancel()
+  {
+    mCanceled = true;
+  }
+
+  const TimeStamp& DispatchTime() const
+  {
+    return mDispatchTime;
+  }
+
+private:
+  ~IdleInterSliceGCRunnable();
+
+  TimeStamp mDispatchTime;
+  bool mCanceled;
+};
+
+// The currently pending IdleInterSliceGCRunnable, if any.  The runnable is
+// owned by the event queue; it clears this when it runs or goes away.
+static IdleInterSliceGCRunnable* sIdleInterSliceGC;
+
+static void
+CancelIdleInterSliceGC()
+{
+  if (sIdleInterSliceGC) {
+    sIdleInterSliceGC->Cancel();
+    sIdleInterSliceGC = nullptr;
+  }
+}
+
+IdleInterSliceGCRunnable::~IdleInterSliceGCRunnable()
+{
+  if (sIdleInterSliceGC == this) {
+    sIdleInterSliceGC = nullptr;
+  }
+}
+
+NS_IMETHODIMP
+IdleInterSliceGCRunnable::Run()
+{
+  if (mCanceled) {
+    return NS_OK;
+  }
+  Telemetry::AccumulateTimeDelta(Telemetry::GC_SLICE_IDLE_WAIT_MS,
+                                 mDispatchTime);
+  Telemetry::Accumulate(Telemetry::GC_SLICE_RAN_WHEN_IDLE, true);
+  // Also cancels the fallback timer.
+  nsJSContext::KillInterSliceGCTimer();
+  // The GC may have been finished by someone else while we were waiting,
+  // and we don't want to start a new one.
+  if (sCCLockedOut) {
+    InterSliceGC();
+  }
+  return NS_OK;
+}
+
+// static
+void
+InterSliceGCFallbackTimerFired(nsITimer *aTimer, void *aClosure)
+{
+  // The main thread didn't become idle in time; run the slice now.
+  if (sIdleInterSliceGC) {
+    Telemetry::AccumulateTimeDelta(Telemetry::GC_SLICE_IDLE_WAIT_MS,
+                                   sIdleInterSliceGC->DispatchTime());
+  }
+  Telemetry::Accumulate(Telemetry::GC_SLICE_RAN_WHEN_IDLE, false);
+  nsJSContext::KillInterSliceGCTimer();
+  InterSliceGC();
+}
+
+// static
+void
+InterSliceGCTimerFired(nsITimer *aTimer, void *aClosure)
+{
+  nsJSContext::KillInterSliceGCTimer();
+  nsRefPtr<IdleInterSliceGCRunnable> runnable = new IdleInterSliceGCRunnable();
+  nsCOMPtr<nsIRunnable> event = runnable;
+  if (NS_FAILED(NS_IdleDispatchToCurrentThread(event.forget()))) {
+    InterSliceGC();
+    return;
+  }
+  sIdleInterSliceGC = runnable;
+
+  // Don't let the slice wait for an idle main thread indefinitely.  The
+  // fallback timer keeps sInterSliceGCTimer set while the slice is pending.
+  CallCreateInstance("@mozilla.org/timer;1", &sInterSliceGCTimer);
+  sInterSliceGCTimer->InitWithFuncCallback(InterSliceGCFallbackTimerFired,
+                                           nullptr,
+                                           NS_INTERSLICE_GC_IDLE_WAIT,
+                                           nsITimer::TYPE_ONE_SHOT);
+}
+
 // static
 void
 GCTimerFired(nsITimer *aTimer, void *aClosure)
@@ -1996,7 +2108,10 @@ nsJSContext::RunNextCollectorTimer()
   }
 
   if (sInterSliceGCTimer) {
-    InterSliceGCTimerFired(nullptr, nullptr);
+    // Run the slice synchronously; callers expect progress by the time this
+    // returns.
+    KillInterSliceGCTimer();
+    InterSliceGC();
     return;
   }
 
@@ -2146,6 +2261,7 @@ nsJSContext::KillFullGCTimer()
 void
 nsJSContext::KillInterSliceGCTimer()
 {
+  CancelIdleInterSliceGC();
   if (sInterSliceGCTimer) {
     sInterSliceGCTimer->Cancel();
     NS_RELEASE(sInterSliceGCTimer);
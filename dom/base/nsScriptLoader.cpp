@@ -52,6 +52,8 @@
 #include "mozilla/dom/EncodingUtils.h"
 
 #include "mozilla/Attributes.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "mozilla/unused.h"
 
 static PRLogModuleInfo* gCspPRLog;
@@ -771,11 +773,15 @@ class NotifyOffThreadScriptLoadCompletedRunnable : public nsRunnable
   nsRefPtr<nsScriptLoadRequest> mRequest;
   nsRefPtr<nsScriptLoader> mLoader;
   void *mToken;
+  // When the off-thread parse was started, which is right after the script
+  // finished downloading.
+  TimeStamp mStartTime;
 
 public:
   NotifyOffThreadScriptLoadCompletedRunnable(nsScriptLoadRequest* aRequest,
                                              nsScriptLoader* aLoader)
     : mRequest(aRequest), mLoader(aLoader), mToken(nullptr)
+    , mStartTime(TimeStamp::Now())
   {}
 
   virtual ~NotifyOffThreadScriptLoadCompletedRunnable();
@@ -820,6 +826,9 @@ NotifyOffThreadScriptLoadCompletedRunnable::Run()
 {
   MOZ_ASSERT(NS_IsMainThread());
 
+  Telemetry::AccumulateTimeDelta(Telemetry::DOM_SCRIPT_OFF_THREAD_PARSE_MS,
+                                 mStartTime);
+
   // We want these to be dropped on the main thread, once we return from this
   // function.
   nsRefPtr<nsScriptLoadRequest> request = mRequest.forget();
@@ -174,6 +174,7 @@ FirstNon8BitUnvectorized(const char16_t *str, const char16_t *end)
 namespace mozilla {
   namespace SSE2 {
     int32_t FirstNon8Bit(const char16_t *str, const char16_t *end);
+    int32_t FirstPossiblyBidi(const char16_t *str, const char16_t *end);
   } // namespace SSE2
 } // namespace mozilla
 #endif
@@ -197,6 +198,29 @@ FirstNon8Bit(const char16_t *str, const char16_t *end)
   return FirstNon8BitUnvectorized(str, end);
 }
 
+/*
+ * This function returns -1 if no code unit in str is in kBidiUnitRanges, so
+ * none of them can be bidi. Otherwise it returns the index of the first such
+ * code unit.
+ */
+static inline int32_t
+FirstPossiblyBidi(const char16_t *str, const char16_t *end)
+{
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    return mozilla::SSE2::FirstPossiblyBidi(str, end);
+  }
+#endif
+
+  const int32_t len = end - str;
+  for (int32_t i = 0; i < len; i++) {
+    if (IsPossiblyBidiUnit(str[i]))
+      return i;
+  }
+
+  return -1;
+}
+
 bool
 nsTextFragment::SetTo(const char16_t* aBuffer, int32_t aLength, bool aUpdateBidi)
 {
@@ -452,9 +476,17 @@ void
 nsTextFragment::UpdateBidiFlag(const char16_t* aBuffer, uint32_t aLength)
 {
   if (mState.mIs2b && !mState.mIsBidi) {
+    // Skip the runs of code units that can't be bidi, and only classify the
+    // characters in between. Surrogates are never skipped, so we stay in
+    // step with surrogate pairs.
     const char16_t* cp = aBuffer;
-    const char16_t* end = cp + aLength;
+    const char16_t* end = aBuffer + aLength;
     while (cp < end) {
+      int32_t nextPossiblyBidi = FirstPossiblyBidi(cp, end);
+      if (nextPossiblyBidi == -1) {
+        break;
+      }
+      cp += nextPossiblyBidi;
       char16_t ch1 = *cp++;
       uint32_t utf32Char = ch1;
       if (NS_IS_HIGH_SURROGATE(ch1) &&
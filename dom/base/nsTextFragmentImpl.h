@@ -30,4 +30,35 @@ template<> struct Non8BitParameters<8> {
   static inline uint32_t numUnicharsPerWord() { return 4; }
 };
 
+// The ranges of UTF-16 code units that can be, or be part of, a bidi
+// character or a bidi control: the BMP RTL blocks (which include ALM), LRM and
+// RLM, LRE to RLO, LRI to PDI, the RTL presentation forms, and surrogates,
+// which may encode an SMP RTL character. See UTF32_CHAR_IS_BIDI and
+// IsBidiControl. Everything else, e.g. CJK or typographic punctuation, is
+// neither.
+struct BidiUnitRange {
+  char16_t mFirst;
+  char16_t mLast;
+};
+
+static const BidiUnitRange kBidiUnitRanges[] = {
+  { 0x0590, 0x08FF },
+  { 0x200E, 0x200F },
+  { 0x202A, 0x202E },
+  { 0x2066, 0x2069 },
+  { 0xD800, 0xDFFF },
+  { 0xFB1D, 0xFEFC },
+};
+
+static inline bool
+IsPossiblyBidiUnit(char16_t aUnit)
+{
+  for (const BidiUnitRange& range : kBidiUnitRanges) {
+    if (aUnit >= range.mFirst && aUnit <= range.mLast) {
+      return true;
+    }
+  }
+  return false;
+}
+
 #endif
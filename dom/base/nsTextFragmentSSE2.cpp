@@ -11,6 +11,8 @@
 #include "nscore.h"
 #include "nsAlgorithm.h"
 #include "nsTextFragmentImpl.h"
+#include "mozilla/ArrayUtils.h"
+#include "mozilla/MathAlgorithms.h"
 #include <algorithm>
 
 namespace mozilla {
@@ -70,5 +72,61 @@ FirstNon8Bit(const char16_t *str, const char16_t *end)
   return -1;
 }
 
+int32_t
+FirstPossiblyBidi(const char16_t *str, const char16_t *end)
+{
+  const uint32_t numUnicharsPerVector = 8;
+  const int32_t len = end - str;
+  int32_t i = 0;
+
+  // Align ourselves to a 16-byte boundary, as required by _mm_load_si128
+  // (i.e. MOVDQA).
+  int32_t alignLen =
+    std::min(len, int32_t(((-NS_PTR_TO_INT32(str)) & 0xf) / sizeof(char16_t)));
+  for (; i < alignLen; i++) {
+    if (IsPossiblyBidiUnit(str[i]))
+      return i;
+  }
+
+  // SSE2 has no unsigned 16-bit compare. Instead, a unit is in [first, last]
+  // exactly when the saturating subtraction of (last - first) from
+  // (unit - first), computed with wraparound, is zero.
+  const size_t numRanges = ArrayLength(kBidiUnitRanges);
+  __m128i firsts[numRanges];
+  __m128i widths[numRanges];
+  for (size_t r = 0; r < numRanges; r++) {
+    const BidiUnitRange& range = kBidiUnitRanges[r];
+    firsts[r] = _mm_set1_epi16(static_cast<int16_t>(range.mFirst));
+    widths[r] =
+      _mm_set1_epi16(static_cast<int16_t>(range.mLast - range.mFirst));
+  }
+  const __m128i zero = _mm_setzero_si128();
+
+  const int32_t vectWalkEnd =
+    i + ((len - i) / numUnicharsPerVector) * numUnicharsPerVector;
+  for(; i < vectWalkEnd; i += numUnicharsPerVector) {
+    const __m128i vect = *reinterpret_cast<const __m128i*>(str + i);
+    __m128i inRange = zero;
+    for (size_t r = 0; r < numRanges; r++) {
+      __m128i offset = _mm_sub_epi16(vect, firsts[r]);
+      inRange = _mm_or_si128(inRange,
+        _mm_cmpeq_epi16(_mm_subs_epu16(offset, widths[r]), zero));
+    }
+    // Each 16-bit lane contributes two bits to the mask.
+    int mask = _mm_movemask_epi8(inRange);
+    if (mask)
+      return i + CountTrailingZeroes32(mask) / 2;
+  }
+
+  // Take care of the remainder one character at a time.
+  for (; i < len; i++) {
+    if (IsPossiblyBidiUnit(str[i])) {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
 } // namespace SSE2
 } // namespace mozilla
@@ -395,6 +395,13 @@ CollectWindowReports(nsGlobalWindow *aWindow,
   aWindowTotalSizes->mArenaStats.mStyleStructs
     += windowSizes.mArenaStats.mStyleStructs;
 
+  REPORT_SIZE("/layout/arena-free-lists",
+              windowSizes.mArenaStats.mFreeListEntries,
+              "Memory used by dead objects sitting on the PresShell arena's "
+              "free lists, waiting to be reused, within a window.");
+  aWindowTotalSizes->mArenaStats.mFreeListEntries
+    += windowSizes.mArenaStats.mFreeListEntries;
+
   REPORT_SIZE("/layout/style-sets", windowSizes.mLayoutStyleSetsSize,
               "Memory used by style sets within a window.");
   aWindowTotalSizes->mLayoutStyleSetsSize += windowSizes.mLayoutStyleSetsSize;
@@ -605,6 +612,10 @@ nsWindowMemoryReporter::CollectReports(nsIMemoryReporterCallback* aCb,
          windowTotalSizes.mArenaStats.mStyleStructs,
          "This is the sum of all windows' 'layout/style-structs' numbers.");
 
+  REPORT("window-objects/layout/arena-free-lists",
+         windowTotalSizes.mArenaStats.mFreeListEntries,
+         "This is the sum of all windows' 'layout/arena-free-lists' numbers.");
+
   REPORT("window-objects/layout/style-sets", windowTotalSizes.mLayoutStyleSetsSize,
          "This is the sum of all windows' 'layout/style-sets' numbers.");
 
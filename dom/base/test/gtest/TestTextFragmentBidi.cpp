@@ -0,0 +1,111 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this file,
+ * You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "gtest/gtest.h"
+#include "nsTextFragmentImpl.h"
+#include "mozilla/Alignment.h"
+#include "mozilla/SSE.h"
+
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+namespace mozilla {
+  namespace SSE2 {
+    int32_t FirstPossiblyBidi(const char16_t *str, const char16_t *end);
+  } // namespace SSE2
+} // namespace mozilla
+
+static int32_t
+FirstPossiblyBidiScalar(const char16_t* aStr, const char16_t* aEnd)
+{
+  for (const char16_t* p = aStr; p < aEnd; ++p) {
+    if (IsPossiblyBidiUnit(*p)) {
+      return p - aStr;
+    }
+  }
+  return -1;
+}
+
+// Three full vectors (positions 0-23) and a tail of five units that is not a
+// multiple of 8.
+static const int32_t kLength = 29;
+
+// Positions at both ends of each vector, and in the tail.
+static const int32_t kPositions[] = { 0, 7, 8, 15, 16, 23, 24, 26, 28 };
+
+// Code units that are never possibly bidi, used to fill the string.
+static const char16_t kFillers[] = {
+  0x0000, 'a', 0x00FF, 0x058F, 0x2014, 0x4E00, 0xFFFF
+};
+
+static void
+CheckUnit(char16_t* aBuffer, char16_t aFiller, char16_t aUnit)
+{
+  for (int32_t position : kPositions) {
+    for (int32_t i = 0; i < kLength; i++) {
+      aBuffer[i] = aFiller;
+    }
+    aBuffer[position] = aUnit;
+
+    int32_t expected = FirstPossiblyBidiScalar(aBuffer, aBuffer + kLength);
+    EXPECT_EQ(IsPossiblyBidiUnit(aUnit) ? position : -1, expected);
+    EXPECT_EQ(expected,
+              mozilla::SSE2::FirstPossiblyBidi(aBuffer, aBuffer + kLength))
+      << "unit " << std::hex << uint32_t(aUnit) << " filler "
+      << uint32_t(aFiller) << std::dec << " at " << position;
+  }
+}
+
+static void
+CheckRangeBoundaries(char16_t* aBuffer)
+{
+  for (char16_t filler : kFillers) {
+    for (const BidiUnitRange& range : kBidiUnitRanges) {
+      CheckUnit(aBuffer, filler, range.mFirst - 1);
+      CheckUnit(aBuffer, filler, range.mFirst);
+      CheckUnit(aBuffer, filler, range.mFirst + (range.mLast - range.mFirst) / 2);
+      CheckUnit(aBuffer, filler, range.mLast);
+      CheckUnit(aBuffer, filler, range.mLast + 1);
+    }
+  }
+}
+
+TEST(TextFragment, FirstPossiblyBidiSSE2)
+{
+  if (!mozilla::supports_sse2()) {
+    return;
+  }
+
+  // Spare room for the misaligned start below.
+  MOZ_ALIGNED_DECL(char16_t buffer[kLength + 8], 16);
+
+  // Starting on a 16-byte boundary, everything up to position 24 goes
+  // through the vector walk.
+  CheckRangeBoundaries(buffer);
+
+  // Starting off the boundary, the first units are checked one at a time.
+  CheckRangeBoundaries(buffer + 3);
+}
+
+TEST(TextFragment, FirstPossiblyBidiSSE2Lengths)
+{
+  if (!mozilla::supports_sse2()) {
+    return;
+  }
+
+  MOZ_ALIGNED_DECL(char16_t buffer[kLength], 16);
+  for (int32_t i = 0; i < kLength; i++) {
+    buffer[i] = 'a';
+  }
+
+  // Strings that end just before a possibly bidi unit must not see it.
+  buffer[kLength - 1] = 0x05D0;
+  for (int32_t length = 0; length < kLength; length++) {
+    EXPECT_EQ(-1, mozilla::SSE2::FirstPossiblyBidi(buffer, buffer + length))
+      << "length " << length;
+  }
+  EXPECT_EQ(kLength - 1,
+            mozilla::SSE2::FirstPossiblyBidi(buffer, buffer + kLength));
+}
+#endif
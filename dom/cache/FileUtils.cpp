@@ -230,15 +230,19 @@ BodyOpen(const QuotaInfo& aQuotaInfo, nsIFile* aBaseDir, const nsID& aId,
                              getter_AddRefs(finalFile));
   if (NS_WARN_IF(NS_FAILED(rv))) { return rv; }
 
-  bool exists;
-  rv = finalFile->Exists(&exists);
-  if (NS_WARN_IF(NS_FAILED(rv))) { return rv; }
-  if (NS_WARN_IF(!exists)) { return NS_ERROR_FILE_NOT_FOUND; }
-
+  // Opening the file fails if it is missing, so only stat it to pick the
+  // error code when that happens.  This saves a syscall per body when
+  // matchAll() returns many responses.
   nsCOMPtr<nsIInputStream> fileStream =
     FileInputStream::Create(PERSISTENCE_TYPE_DEFAULT, aQuotaInfo.mGroup,
                             aQuotaInfo.mOrigin, finalFile);
-  if (NS_WARN_IF(!fileStream)) { return NS_ERROR_UNEXPECTED; }
+  if (NS_WARN_IF(!fileStream)) {
+    bool exists;
+    rv = finalFile->Exists(&exists);
+    if (NS_WARN_IF(NS_FAILED(rv))) { return rv; }
+    if (NS_WARN_IF(!exists)) { return NS_ERROR_FILE_NOT_FOUND; }
+    return NS_ERROR_UNEXPECTED;
+  }
 
   fileStream.forget(aStreamOut);
 
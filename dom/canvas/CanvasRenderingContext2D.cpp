@@ -2479,6 +2479,14 @@ CanvasRenderingContext2D::FillRect(double x, double y, double w,
     }
   }
 
+  // An empty fill with the OVER operator can't change any pixels (filters
+  // aside, which may generate content from nothing), so don't bother the
+  // backend or invalidate anything for it.
+  if ((!w || !h) && state.op == mgfx::CompositionOp::OP_OVER &&
+      !NeedToApplyFilter()) {
+    return;
+  }
+
   mgfx::Rect bounds;
 
   EnsureTarget();
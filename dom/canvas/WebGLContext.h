@@ -1015,6 +1015,9 @@ private:
     bool mBufferFetchingHasPerVertex;
     uint32_t mMaxFetchedVertices;
     uint32_t mMaxFetchedInstances;
+    // What attrib 0 needs for the current program and vertex array; it only
+    // changes with the same state that invalidates the fetching limits.
+    WebGLVertexAttrib0Status mBufferFetchingAttrib0Status;
 
     bool DrawArrays_check(GLint first, GLsizei count, GLsizei primcount,
                           const char* info);
@@ -1071,6 +1074,7 @@ protected:
         mBufferFetchingHasPerVertex = false;
         mMaxFetchedVertices = 0;
         mMaxFetchedInstances = 0;
+        mBufferFetchingAttrib0Status = WebGLVertexAttrib0Status::Default;
     }
 
     CheckedUint32 mGeneration;
@@ -493,6 +493,7 @@ WebGLContext::ValidateBufferFetching(const char* info)
     mBufferFetchingHasPerVertex = hasPerVertex;
     mMaxFetchedVertices = maxVertices;
     mMaxFetchedInstances = maxInstances;
+    mBufferFetchingAttrib0Status = WhatDoesVertexAttrib0Need();
 
     return true;
 }
@@ -527,7 +528,9 @@ WebGLContext::WhatDoesVertexAttrib0Need()
 bool
 WebGLContext::DoFakeVertexAttrib0(GLuint vertexCount)
 {
-    WebGLVertexAttrib0Status whatDoesAttrib0Need = WhatDoesVertexAttrib0Need();
+    // Resolved along with the buffer fetching limits in ValidateBufferFetching.
+    MOZ_ASSERT(mBufferFetchingIsVerified);
+    WebGLVertexAttrib0Status whatDoesAttrib0Need = mBufferFetchingAttrib0Status;
 
     if (MOZ_LIKELY(whatDoesAttrib0Need == WebGLVertexAttrib0Status::Default))
         return true;
@@ -617,7 +620,9 @@ WebGLContext::DoFakeVertexAttrib0(GLuint vertexCount)
 void
 WebGLContext::UndoFakeVertexAttrib0()
 {
-    WebGLVertexAttrib0Status whatDoesAttrib0Need = WhatDoesVertexAttrib0Need();
+    // Resolved along with the buffer fetching limits in ValidateBufferFetching.
+    MOZ_ASSERT(mBufferFetchingIsVerified);
+    WebGLVertexAttrib0Status whatDoesAttrib0Need = mBufferFetchingAttrib0Status;
 
     if (MOZ_LIKELY(whatDoesAttrib0Need == WebGLVertexAttrib0Status::Default))
         return;
@@ -459,6 +459,9 @@ WebGLElementArrayCacheTree<T>::Update(size_t firstByte, size_t lastByte)
 }
 
 WebGLElementArrayCache::WebGLElementArrayCache()
+    : mHasPendingUpdate(false)
+    , mPendingFirstByte(0)
+    , mPendingLastByte(0)
 {
 }
 
@@ -469,6 +472,9 @@ WebGLElementArrayCache::~WebGLElementArrayCache()
 bool
 WebGLElementArrayCache::BufferData(const void* ptr, size_t byteLength)
 {
+    // Whatever was pending is about to be overwritten by the whole buffer.
+    mHasPendingUpdate = false;
+
     if (mBytes.Length() != byteLength) {
         if (!mBytes.SetLength(byteLength, fallible)) {
             mBytes.Clear();
@@ -491,20 +497,40 @@ WebGLElementArrayCache::BufferSubData(size_t pos, const void* ptr,
         memcpy(mBytes.Elements() + pos, ptr, updateByteLength);
     else
         memset(mBytes.Elements() + pos, 0, updateByteLength);
-    return UpdateTrees(pos, pos + updateByteLength - 1);
+
+    // The trees are only consulted by Validate, so just remember what changed
+    // and let the next Validate call bring them up to date.
+    size_t lastByte = pos + updateByteLength - 1;
+    if (mHasPendingUpdate) {
+        mPendingFirstByte = std::min(mPendingFirstByte, pos);
+        mPendingLastByte = std::max(mPendingLastByte, lastByte);
+    } else {
+        mHasPendingUpdate = true;
+        mPendingFirstByte = pos;
+        mPendingLastByte = lastByte;
+    }
+    return true;
 }
 
-bool
-WebGLElementArrayCache::UpdateTrees(size_t firstByte, size_t lastByte)
+void
+WebGLElementArrayCache::FlushPendingUpdates()
 {
-    bool result = true;
-    if (mUint8Tree)
-        result &= mUint8Tree->Update(firstByte, lastByte);
-    if (mUint16Tree)
-        result &= mUint16Tree->Update(firstByte, lastByte);
-    if (mUint32Tree)
-        result &= mUint32Tree->Update(firstByte, lastByte);
-    return result;
+    if (!mHasPendingUpdate)
+        return;
+
+    mHasPendingUpdate = false;
+    MOZ_ASSERT(mPendingLastByte < mBytes.Length());
+
+    // A tree that fails to update (i.e. fails to allocate) is dropped, so that
+    // Validate rebuilds it from scratch on its next use.
+    size_t first = mPendingFirstByte;
+    size_t last = mPendingLastByte;
+    if (mUint8Tree && !mUint8Tree->Update(first, last))
+        mUint8Tree = nullptr;
+    if (mUint16Tree && !mUint16Tree->Update(first, last))
+        mUint16Tree = nullptr;
+    if (mUint32Tree && !mUint32Tree->Update(first, last))
+        mUint32Tree = nullptr;
 }
 
 template<typename T>
@@ -532,6 +558,8 @@ WebGLElementArrayCache::Validate(uint32_t maxAllowed, size_t firstElement,
     if (!mBytes.Length() || !countElements)
       return true;
 
+    FlushPendingUpdates();
+
     ScopedDeletePtr<WebGLElementArrayCacheTree<T>>& tree = TreeForType<T>::Value(this);
     if (!tree) {
         tree = new WebGLElementArrayCacheTree<T>(*this);
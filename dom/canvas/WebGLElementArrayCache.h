@@ -85,7 +85,7 @@ private:
     template<typename T>
     T* Elements() { return reinterpret_cast<T*>(mBytes.Elements()); }
 
-    bool UpdateTrees(size_t firstByte, size_t lastByte);
+    void FlushPendingUpdates();
 
     template<typename T>
     friend struct WebGLElementArrayCacheTree;
@@ -96,6 +96,14 @@ private:
     ScopedDeletePtr<WebGLElementArrayCacheTree<uint8_t>> mUint8Tree;
     ScopedDeletePtr<WebGLElementArrayCacheTree<uint16_t>> mUint16Tree;
     ScopedDeletePtr<WebGLElementArrayCacheTree<uint32_t>> mUint32Tree;
+
+    // Byte range written by BufferData/BufferSubData since the trees were
+    // last brought up to date. Tree updates are deferred to the next Validate
+    // call, so a buffer that is re-uploaded several times between draws only
+    // pays for one update.
+    bool mHasPendingUpdate;
+    size_t mPendingFirstByte;
+    size_t mPendingLastByte;
 };
 
 } // end namespace mozilla
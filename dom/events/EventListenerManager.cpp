@@ -106,6 +106,7 @@ EventListenerManager::EventListenerManager(EventTarget* aTarget)
   , mClearingListeners(false)
   , mIsMainThreadELM(NS_IsMainThread())
   , mNoListenerForEvent(0)
+  , mMayHaveListenerForEventTypes(0)
   , mTarget(aTarget)
 {
   NS_ASSERTION(aTarget, "unexpected null pointer");
@@ -138,6 +139,7 @@ EventListenerManager::RemoveAllListeners()
   }
   mClearingListeners = true;
   mListeners.Clear();
+  mMayHaveListenerForEventTypes = 0;
   mClearingListeners = false;
 }
 
@@ -249,6 +251,8 @@ EventListenerManager::AddEventListenerInternal(
 
   mNoListenerForEvent = NS_EVENT_NULL;
   mNoListenerForEventAtom = nullptr;
+  mMayHaveListenerForEventTypes |= aAllEvents ? UINT64_MAX :
+                                                EventTypeBit(aType);
 
   listener = aAllEvents ? mListeners.InsertElementAt(0) :
                           mListeners.AppendElement();
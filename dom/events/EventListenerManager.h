@@ -320,6 +320,13 @@ public:
       return;
     }
 
+    // User defined events are matched by atom, so only listeners for known
+    // event types can be ruled out by type.
+    if (aEvent->message != NS_USER_DEFINED_EVENT &&
+        !(mMayHaveListenerForEventTypes & EventTypeBit(aEvent->message))) {
+      return;
+    }
+
     // Check if we already know that there is no event listener for the event.
     if (mNoListenerForEvent == aEvent->message &&
         (mNoListenerForEvent != NS_USER_DEFINED_EVENT ||
@@ -549,6 +556,11 @@ protected:
 
   bool ListenerCanHandle(Listener* aListener, WidgetEvent* aEvent);
 
+  static uint64_t EventTypeBit(uint32_t aType)
+  {
+    return uint64_t(1) << (aType % 64);
+  }
+
   already_AddRefed<nsIScriptGlobalObject>
   GetScriptGlobalAndDocument(nsIDocument** aDoc);
 
@@ -564,6 +576,10 @@ protected:
   uint32_t mClearingListeners : 1;
   uint32_t mIsMainThreadELM : 1;
   uint32_t mNoListenerForEvent : 21;
+  // One bit per EventTypeBit() of every listener added since the last
+  // RemoveAllListeners(). Bits are not cleared when single listeners are
+  // removed, so a set bit only means there may be a listener.
+  uint64_t mMayHaveListenerForEventTypes;
 
   nsAutoTObserverArray<Listener, 2> mListeners;
   dom::EventTarget* MOZ_NON_OWNING_REF mTarget;
@@ -1563,8 +1563,16 @@ FetchBody<Derived>::ContinueConsumeBody(nsresult aStatus, uint32_t aResultLength
     case CONSUME_TEXT:
       // fall through handles early exit.
     case CONSUME_JSON: {
+      // JSON bodies are usually pure ASCII, which the JS engine can parse as
+      // Latin1 directly instead of going through a UTF-16 copy first.
+      bool asciiJSON = mConsumeType == CONSUME_JSON &&
+                       IsASCII(nsDependentCSubstring(reinterpret_cast<char*>(aResult),
+                                                     aResultLength));
+
       StreamDecoder decoder;
-      decoder.AppendText(reinterpret_cast<char*>(aResult), aResultLength);
+      if (!asciiJSON) {
+        decoder.AppendText(reinterpret_cast<char*>(aResult), aResultLength);
+      }
 
       nsString& decoded = decoder.GetText();
       if (mConsumeType == CONSUME_TEXT) {
@@ -1574,7 +1582,10 @@ FetchBody<Derived>::ContinueConsumeBody(nsresult aStatus, uint32_t aResultLength
 
       AutoForceSetExceptionOnContext forceExn(cx);
       JS::Rooted<JS::Value> json(cx);
-      if (!JS_ParseJSON(cx, decoded.get(), decoded.Length(), &json)) {
+      bool ok = asciiJSON
+                ? JS_ParseJSON(cx, reinterpret_cast<JS::Latin1Char*>(aResult), aResultLength, &json)
+                : JS_ParseJSON(cx, decoded.get(), decoded.Length(), &json);
+      if (!ok) {
         if (!JS_IsExceptionPending(cx)) {
           localPromise->MaybeReject(NS_ERROR_DOM_UNKNOWN_ERR);
           return;
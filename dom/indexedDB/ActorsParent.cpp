@@ -28,6 +28,7 @@
 #include "mozilla/Preferences.h"
 #include "mozilla/Services.h"
 #include "mozilla/StaticPtr.h"
+#include "mozilla/Telemetry.h"
 #include "mozilla/storage.h"
 #include "mozilla/unused.h"
 #include "mozilla/dom/ContentParent.h"
@@ -163,6 +164,10 @@ const int32_t kSQLiteSchemaVersion =
 
 const int32_t kStorageProgressGranularity = 1000;
 
+// Compressed values whose buffer would waste more than this many bytes of
+// snappy's worst case allocation are shrunk before being bound.
+const size_t kLargeValueCompressedSlack = 64 * 1024;
+
 // Changing the value here will override the page size of new databases only.
 // A journal mode change and VACUUM are needed to change existing databases, so
 // the best way to do that is to use the schema version upgrade mechanism.
@@ -6022,6 +6027,8 @@ private:
   const nsCString mDatabaseId;
   const int64_t mLoggingSerialNumber;
   uint64_t mActiveRequestCount;
+  uint64_t mTotalRequestCount;
+  TimeStamp mFirstRequestTime;
   Atomic<bool> mInvalidatedOnAnyThread;
   const Mode mMode;
   bool mHasBeenActive;
@@ -6268,6 +6275,9 @@ private:
 
   void
   CommitOrAbort();
+
+  void
+  AccumulateRequestTelemetry(nsresult aResult);
 };
 
 class TransactionBase::CommitOp final
@@ -12974,6 +12984,7 @@ TransactionBase::TransactionBase(Database* aDatabase, Mode aMode)
   , mDatabaseId(aDatabase->Id())
   , mLoggingSerialNumber(aDatabase->GetLoggingInfo()->NextTransactionSN(aMode))
   , mActiveRequestCount(0)
+  , mTotalRequestCount(0)
   , mInvalidatedOnAnyThread(false)
   , mMode(aMode)
   , mHasBeenActive(false)
@@ -13552,7 +13563,12 @@ TransactionBase::NoteActiveRequest()
   AssertIsOnBackgroundThread();
   MOZ_ASSERT(mActiveRequestCount < UINT64_MAX);
 
+  if (!mTotalRequestCount) {
+    mFirstRequestTime = TimeStamp::Now();
+  }
+
   mActiveRequestCount++;
+  mTotalRequestCount++;
 }
 
 void
@@ -13566,6 +13582,31 @@ TransactionBase::NoteFinishedRequest()
   MaybeCommitOrAbort();
 }
 
+void
+TransactionBase::AccumulateRequestTelemetry(nsresult aResult)
+{
+  AssertIsOnBackgroundThread();
+  MOZ_ASSERT(!mActiveRequestCount);
+
+  if (NS_FAILED(aResult) || !mTotalRequestCount) {
+    return;
+  }
+
+  Telemetry::Accumulate(Telemetry::IDB_TRANSACTION_REQUEST_COUNT,
+                        uint32_t(std::min<uint64_t>(mTotalRequestCount,
+                                                    UINT32_MAX)));
+
+  // Measure from the first request rather than from creation so that time the
+  // transaction spent queued behind others is not counted against it.
+  double seconds = (TimeStamp::Now() - mFirstRequestTime).ToSeconds();
+  if (seconds > 0) {
+    double opsPerSecond = double(mTotalRequestCount) / seconds;
+    Telemetry::Accumulate(Telemetry::IDB_TRANSACTION_OPS_PER_SEC,
+                          uint32_t(std::min<double>(opsPerSecond,
+                                                    UINT32_MAX)));
+  }
+}
+
 void
 TransactionBase::Invalidate()
 {
@@ -21294,6 +21335,8 @@ CommitOp::TransactionFinishedAfterUnblock()
 
   mTransaction->SendCompleteNotification(ClampResultCode(mResultCode));
 
+  mTransaction->AccumulateRequestTelemetry(mResultCode);
+
   Database* database = mTransaction->GetDatabase();
   MOZ_ASSERT(database);
 
@@ -23141,6 +23184,19 @@ ObjectStoreAddOrPutRequestOp::DoDatabaseWork(DatabaseConnection* aConnection)
     snappy::RawCompress(uncompressed, uncompressedLength, compressed,
                         &compressedLength);
 
+    // The statement keeps the buffer alive until the transaction is done with
+    // it, so don't hold on to snappy's worst case allocation for large values.
+    if (snappy::MaxCompressedLength(uncompressedLength) - compressedLength >
+          kLargeValueCompressedSlack) {
+      char* shrunk = static_cast<char*>(realloc(compressed, compressedLength));
+      if (shrunk) {
+        compressed = shrunk;
+      }
+    }
+
+    Telemetry::Accumulate(Telemetry::IDB_STORED_VALUE_SIZE_KB,
+                          uint32_t(uncompressedLength / 1024));
+
     uint8_t* dataBuffer = reinterpret_cast<uint8_t*>(compressed);
     size_t dataBufferLength = compressedLength;
 
@@ -20,6 +20,7 @@
 #include "nsIPrincipal.h"
 #include "mozilla/Attributes.h"
 #include "mozilla/Services.h"
+#include "mozilla/Telemetry.h"
 #include <algorithm>
 
 namespace mozilla {
@@ -2218,6 +2219,8 @@ MediaCacheStream::Read(char* aBuffer, uint32_t aCount, uint32_t* aBytes)
     return NS_ERROR_FAILURE;
 
   uint32_t count = 0;
+  // Set when we first have to wait for the network to deliver data.
+  TimeStamp stallStart;
   // Read one block (or part of a block) at a time
   while (count < aCount) {
     uint32_t streamBlock = uint32_t(mStreamOffset/BLOCK_SIZE);
@@ -2279,6 +2282,9 @@ MediaCacheStream::Read(char* aBuffer, uint32_t aCount, uint32_t* aBytes)
       }
 
       // No data has been read yet, so block
+      if (stallStart.IsNull()) {
+        stallStart = TimeStamp::Now();
+      }
       mon.Wait();
       if (mClosed) {
         // We may have successfully read some data, but let's just throw
@@ -2308,6 +2314,13 @@ MediaCacheStream::Read(char* aBuffer, uint32_t aCount, uint32_t* aBytes)
     // Some data was read, so queue an update since block priorities may
     // have changed
     gMediaCache->QueueUpdate();
+
+    Telemetry::Accumulate(Telemetry::MEDIACACHE_READ_STALLED,
+                          !stallStart.IsNull());
+    if (!stallStart.IsNull()) {
+      Telemetry::AccumulateTimeDelta(Telemetry::MEDIACACHE_READ_STALL_MS,
+                                     stallStart);
+    }
   }
   CACHE_LOG(LogLevel::Debug,
             ("Stream %p Read at %lld count=%d", this, (long long)(mStreamOffset-count), count));
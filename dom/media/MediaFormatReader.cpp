@@ -607,8 +607,10 @@ MediaFormatReader::OnDemuxFailed(TrackType aTrack, DemuxerFailureReason aFailure
 void
 MediaFormatReader::DoDemuxVideo()
 {
-  // TODO Use DecodeAhead value rather than 1.
-  mVideo.mDemuxRequest.Begin(mVideo.mTrackDemuxer->GetSamples(1)
+  // Demux as many samples as the decoder may run ahead by, so they can all be
+  // given to it at once rather than costing a demux round trip each.
+  int32_t count = std::max<int32_t>(1, int32_t(mVideo.mDecodeAhead));
+  mVideo.mDemuxRequest.Begin(mVideo.mTrackDemuxer->GetSamples(count)
                       ->Then(OwnerThread(), __func__, this,
                              &MediaFormatReader::OnVideoDemuxCompleted,
                              &MediaFormatReader::OnVideoDemuxFailed));
@@ -664,8 +666,9 @@ MediaFormatReader::RequestAudioData()
 void
 MediaFormatReader::DoDemuxAudio()
 {
-  // TODO Use DecodeAhead value rather than 1.
-  mAudio.mDemuxRequest.Begin(mAudio.mTrackDemuxer->GetSamples(1)
+  // See DoDemuxVideo.
+  int32_t count = std::max<int32_t>(1, int32_t(mAudio.mDecodeAhead));
+  mAudio.mDemuxRequest.Begin(mAudio.mTrackDemuxer->GetSamples(count)
                       ->Then(OwnerThread(), __func__, this,
                              &MediaFormatReader::OnAudioDemuxCompleted,
                              &MediaFormatReader::OnAudioDemuxFailed));
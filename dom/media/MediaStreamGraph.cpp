@@ -1316,6 +1316,9 @@ MediaStreamGraphImpl::ProduceDataForStreamsBlockByBlock(uint32_t aStreamIndex,
                                                         GraphTime aFrom,
                                                         GraphTime aTo)
 {
+  PROFILER_LABEL("MediaStreamGraphImpl", "ProduceDataForStreamsBlockByBlock",
+    js::ProfileEntry::Category::OTHER);
+
   MOZ_ASSERT(aStreamIndex <= mFirstCycleBreaker,
              "Cycle breaker is not AudioNodeStream?");
   GraphTime t = aFrom;
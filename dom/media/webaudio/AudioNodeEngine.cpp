@@ -9,6 +9,10 @@
 #include "mozilla/arm.h"
 #include "AudioNodeEngineNEON.h"
 #endif
+#include "mozilla/SSE.h"
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+#include "AudioNodeEngineSSE2.h"
+#endif
 
 namespace mozilla {
 
@@ -72,6 +76,12 @@ void AudioBufferAddWithScale(const float* aInput,
     AudioBufferAddWithScale_NEON(aInput, aScale, aOutput, aSize);
     return;
   }
+#endif
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBufferAddWithScale_SSE2(aInput, aScale, aOutput, aSize);
+    return;
+  }
 #endif
   if (aScale == 1.0f) {
     for (uint32_t i = 0; i < aSize; ++i) {
@@ -105,6 +115,12 @@ AudioBlockCopyChannelWithScale(const float* aInput,
       AudioBlockCopyChannelWithScale_NEON(aInput, aScale, aOutput);
       return;
     }
+#endif
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+    if (mozilla::supports_sse2()) {
+      AudioBlockCopyChannelWithScale_SSE2(aInput, aScale, aOutput);
+      return;
+    }
 #endif
     for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
       aOutput[i] = aInput[i]*aScale;
@@ -153,6 +169,12 @@ AudioBlockCopyChannelWithScale(const float aInput[WEBAUDIO_BLOCK_SIZE],
     AudioBlockCopyChannelWithScale_NEON(aInput, aScale, aOutput);
     return;
   }
+#endif
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBlockCopyChannelWithScale_SSE2(aInput, aScale, aOutput);
+    return;
+  }
 #endif
   for (uint32_t i = 0; i < WEBAUDIO_BLOCK_SIZE; ++i) {
     aOutput[i] = aInput[i]*aScale[i];
@@ -179,6 +201,12 @@ AudioBufferInPlaceScale(float* aBlock,
     AudioBufferInPlaceScale_NEON(aBlock, aScale, aSize);
     return;
   }
+#endif
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBufferInPlaceScale_SSE2(aBlock, aScale, aSize);
+    return;
+  }
 #endif
   for (uint32_t i = 0; i < aSize; ++i) {
     *aBlock++ *= aScale;
@@ -221,6 +249,14 @@ AudioBlockPanStereoToStereo(const float aInputL[WEBAUDIO_BLOCK_SIZE],
     return;
   }
 #endif
+#ifdef MOZILLA_MAY_SUPPORT_SSE2
+  if (mozilla::supports_sse2()) {
+    AudioBlockPanStereoToStereo_SSE2(aInputL, aInputR,
+                                     aGainL, aGainR, aIsOnTheLeft,
+                                     aOutputL, aOutputR);
+    return;
+  }
+#endif
 
   uint32_t i;
 
@@ -11,6 +11,7 @@
 #include "AudioChannelFormat.h"
 #include "AudioParamTimeline.h"
 #include "AudioContext.h"
+#include "GeckoProfiler.h"
 
 using namespace mozilla::dom;
 
@@ -494,6 +495,9 @@ AudioNodeStream::ProcessInput(GraphTime aFrom, GraphTime aTo, uint32_t aFlags)
       mLastChunks[i].SetNull(WEBAUDIO_BLOCK_SIZE);
     }
   } else {
+    PROFILER_LABEL("AudioNodeStream", "ProcessInput",
+      js::ProfileEntry::Category::OTHER);
+
     // We need to generate at least one input
     uint16_t maxInputs = std::max(uint16_t(1), mEngine->InputCount());
     OutputChunks inputChunks;
@@ -9,6 +9,7 @@
 #include "AudioNodeEngine.h"
 #include "AudioNodeStream.h"
 #include "blink/Reverb.h"
+#include "GeckoProfiler.h"
 #include "PlayingRefChangeHandler.h"
 
 namespace mozilla {
@@ -106,6 +107,9 @@ public:
                             AudioChunk* aOutput,
                             bool* aFinished) override
   {
+    PROFILER_LABEL("ConvolverNodeEngine", "ProcessBlock",
+      js::ProfileEntry::Category::OTHER);
+
     if (!mReverb) {
       *aOutput = aInput;
       return;
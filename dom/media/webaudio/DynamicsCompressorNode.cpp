@@ -11,6 +11,7 @@
 #include "AudioDestinationNode.h"
 #include "WebAudioUtils.h"
 #include "blink/DynamicsCompressor.h"
+#include "GeckoProfiler.h"
 
 using WebCore::DynamicsCompressor;
 
@@ -97,6 +98,9 @@ public:
                             AudioChunk* aOutput,
                             bool* aFinished) override
   {
+    PROFILER_LABEL("DynamicsCompressorNodeEngine", "ProcessBlock",
+      js::ProfileEntry::Category::OTHER);
+
     if (aInput.IsNull()) {
       // Just output silence
       *aOutput = aInput;
@@ -13,6 +13,7 @@
 #include "PlayingRefChangeHandler.h"
 #include "blink/HRTFPanner.h"
 #include "blink/HRTFDatabaseLoader.h"
+#include "GeckoProfiler.h"
 
 using WebCore::HRTFDatabaseLoader;
 using WebCore::HRTFPanner;
@@ -139,6 +140,9 @@ public:
                             AudioChunk* aOutput,
                             bool *aFinished) override
   {
+    PROFILER_LABEL("PannerNodeEngine", "ProcessBlock",
+      js::ProfileEntry::Category::OTHER);
+
     if (aInput.IsNull()) {
       // mLeftOverData != INT_MIN means that the panning model was HRTF and a
       // tail-time reference was added.  Even if the model is now equalpower,
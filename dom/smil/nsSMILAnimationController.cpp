@@ -15,6 +15,7 @@
 #include "nsSMILTimedElement.h"
 #include <algorithm>
 #include "mozilla/AutoRestore.h"
+#include "mozilla/Telemetry.h"
 #include "RestyleTracker.h"
 
 using namespace mozilla;
@@ -369,6 +370,8 @@ nsSMILAnimationController::DoSample(bool aSkipUnchangedContainers)
     return;
   }
 
+  Telemetry::AutoTimer<Telemetry::SMIL_SAMPLE_TIME> sampleTimer;
+
   mResampleNeeded = false;
   // Set running sample flag -- do this before flushing styles so that when we
   // flush styles we don't end up requesting extra samples
@@ -711,14 +714,21 @@ nsSMILAnimationController::SampleTimedElement(
 nsSMILAnimationController::AddAnimationToCompositorTable(
   SVGAnimationElement* aElement, nsSMILCompositorTable* aCompositorTable)
 {
+  nsSMILAnimationFunction& func = aElement->AnimationFunction();
+
+  // Animations that are waiting to start or have finished (and aren't frozen)
+  // contribute nothing to this sample unless they've only just become
+  // inactive, so don't bother resolving their target. With many animations
+  // in a document most of them are usually in this state.
+  if (!func.IsActiveOrFrozen() && !func.HasChanged())
+    return;
+
   // Add a compositor to the hash table if there's not already one there
   nsSMILTargetIdentifier key;
   if (!GetTargetIdentifierForAnimation(aElement, key))
     // Something's wrong/missing about animation's target; skip this animation
     return;
 
-  nsSMILAnimationFunction& func = aElement->AnimationFunction();
-
   // Only add active animation functions. If there are no active animations
   // targeting an attribute, no compositor will be created and any previously
   // applied animations will be cleared.
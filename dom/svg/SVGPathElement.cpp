@@ -21,6 +21,7 @@
 #include "nsGkAtoms.h"
 #include "nsStyleConsts.h"
 #include "nsStyleStruct.h"
+#include "nsSVGUtils.h"
 #include "SVGContentUtils.h"
 
 NS_IMPL_NS_NEW_NAMESPACED_SVG_ELEMENT(Path)
@@ -308,7 +309,19 @@ SVGPathElement::IsAttributeMapped(const nsIAtom* name) const
 already_AddRefed<Path>
 SVGPathElement::GetOrBuildPathForMeasuring()
 {
-  return mD.GetAnimValue().BuildPathForMeasuring();
+  // The measuring path doesn't depend on style, so unlike the cache used by
+  // GetOrBuildPath it only needs to be dropped when our path data changes.
+  // getTotalLength(), getPointAtLength(), textPath layout and pathLength
+  // scaled stroking would otherwise rebuild it on every call.
+  if (mCachedPathForMeasuring) {
+    RefPtr<Path> path(mCachedPathForMeasuring);
+    return path.forget();
+  }
+  RefPtr<Path> path = mD.GetAnimValue().BuildPathForMeasuring();
+  if (NS_SVGPathCachingEnabled()) {
+    mCachedPathForMeasuring = path;
+  }
+  return path.forget();
 }
 
 //----------------------------------------------------------------------
@@ -28,10 +28,11 @@ nsresult
 nsSVGPathGeometryElement::AfterSetAttr(int32_t aNamespaceID, nsIAtom* aName,
                                        const nsAttrValue* aValue, bool aNotify)
 {
-  if (mCachedPath &&
+  if ((mCachedPath || mCachedPathForMeasuring) &&
       aNamespaceID == kNameSpaceID_None &&
       AttributeDefinesGeometry(aName)) {
     mCachedPath = nullptr;
+    mCachedPathForMeasuring = nullptr;
   }
   return nsSVGPathGeometryElementBase::AfterSetAttr(aNamespaceID, aName,
                                                     aValue, aNotify);
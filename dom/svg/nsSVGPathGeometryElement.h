@@ -48,11 +48,12 @@ public:
                                 const nsAttrValue* aValue, bool aNotify) override;
 
   /**
-   * Causes this element to discard any Path object that GetOrBuildPath may
-   * have cached.
+   * Causes this element to discard any Path object that GetOrBuildPath or
+   * GetOrBuildPathForMeasuring may have cached.
    */
   virtual void ClearAnyCachedPath() override final {
     mCachedPath = nullptr;
+    mCachedPathForMeasuring = nullptr;
   }
 
   virtual bool AttributeDefinesGeometry(const nsIAtom *aName);
@@ -181,6 +182,7 @@ public:
 
 protected:
   mutable mozilla::RefPtr<Path> mCachedPath;
+  mutable mozilla::RefPtr<Path> mCachedPathForMeasuring;
 };
 
 #endif
@@ -1735,6 +1735,8 @@ RuntimeService::ScheduleWorker(JSContext* aCx, WorkerPrivate* aWorkerPrivate)
     }
   }
 
+  Telemetry::Accumulate(Telemetry::WORKER_THREAD_REUSED, !!thread);
+
   const WorkerThreadFriendKey friendKey;
 
   if (!thread) {
@@ -2830,6 +2832,11 @@ WorkerThreadPrimaryRunnable::Run()
       }
 #endif
 
+      // Everything up to here (thread, PBackground, runtime and context) is
+      // per-worker setup paid before the script can even start loading.
+      Telemetry::AccumulateTimeDelta(Telemetry::WORKER_STARTUP_MS,
+                                     mWorkerPrivate->CreationTimeStamp());
+
       {
         JSAutoRequest ar(cx);
 
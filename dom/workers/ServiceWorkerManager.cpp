@@ -50,6 +50,7 @@
 
 #include "nsContentUtils.h"
 #include "nsGlobalWindow.h"
+#include "nsGkAtoms.h"
 #include "nsNetUtil.h"
 #include "nsIURL.h"
 #include "nsProxyRelease.h"
@@ -3636,6 +3637,16 @@ private:
     MOZ_ASSERT(aCx);
     MOZ_ASSERT(aWorkerPrivate);
     MOZ_ASSERT(aWorkerPrivate->IsServiceWorker());
+
+    // Without a fetch handler nothing can call respondWith(), so don't build
+    // the Request and FetchEvent just to dispatch them to no one. Let the
+    // network request go ahead directly.
+    if (!aWorkerPrivate->GlobalScope()->HasListenersFor(nsGkAtoms::onfetch)) {
+      nsCOMPtr<nsIRunnable> runnable = new ResumeRequest(mInterceptedChannel);
+      MOZ_ALWAYS_TRUE(NS_SUCCEEDED(NS_DispatchToMainThread(runnable)));
+      return true;
+    }
+
     GlobalObject globalObj(aCx, aWorkerPrivate->GlobalScope()->GetWrapper());
 
     NS_ConvertUTF8toUTF16 local(mSpec);
@@ -10,8 +10,16 @@ namespace mozilla {
 namespace gfx {
 
 
+// Initial size of the command buffer, enough for a typical captured layer
+// without reallocating the storage while recording.
+static const size_t kInitialCommandStorageSize = 4096;
+
 DrawTargetCaptureImpl::~DrawTargetCaptureImpl()
 {
+  if (mDrawCommandStorage.empty()) {
+    return;
+  }
+
   uint8_t* start = &mDrawCommandStorage.front();
 
   uint8_t* current = start;
@@ -32,6 +40,7 @@ DrawTargetCaptureImpl::Init(const IntSize& aSize, DrawTarget* aRefDT)
   mRefDT = aRefDT;
 
   mSize = aSize;
+  mDrawCommandStorage.reserve(kInitialCommandStorageSize);
   return true;
 }
 
@@ -183,6 +192,10 @@ DrawTargetCaptureImpl::SetTransform(const Matrix& aTransform)
 void
 DrawTargetCaptureImpl::ReplayToDrawTarget(DrawTarget* aDT, const Matrix& aTransform)
 {
+  if (mDrawCommandStorage.empty()) {
+    return;
+  }
+
   uint8_t* start = &mDrawCommandStorage.front();
 
   uint8_t* current = start;
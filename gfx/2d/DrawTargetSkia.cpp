@@ -29,6 +29,7 @@
 #include "Logging.h"
 #include "Tools.h"
 #include "DataSurfaceHelpers.h"
+#include "mozilla/Vector.h"
 #include <algorithm>
 
 namespace mozilla {
@@ -597,10 +598,14 @@ DrawTargetSkia::FillGlyphs(ScaledFont *aFont,
     paint.mPaint.setHinting(SkPaint::kNormal_Hinting);
   }
 
-  std::vector<uint16_t> indices;
-  std::vector<SkPoint> offsets;
-  indices.resize(aBuffer.mNumGlyphs);
-  offsets.resize(aBuffer.mNumGlyphs);
+  // Like DrawTargetCairo::FillGlyphs, use inline storage so that the common
+  // case of a short glyph run doesn't hit the heap twice per call.
+  Vector<uint16_t, 1024 / sizeof(uint16_t)> indices;
+  Vector<SkPoint, 1024 / sizeof(SkPoint)> offsets;
+  if (!indices.resizeUninitialized(aBuffer.mNumGlyphs) ||
+      !offsets.resizeUninitialized(aBuffer.mNumGlyphs)) {
+    MOZ_CRASH("glyphs allocation failed");
+  }
 
   for (unsigned int i = 0; i < aBuffer.mNumGlyphs; i++) {
     indices[i] = aBuffer.mGlyphs[i].mIndex;
@@ -608,7 +613,7 @@ DrawTargetSkia::FillGlyphs(ScaledFont *aFont,
     offsets[i].fY = SkFloatToScalar(aBuffer.mGlyphs[i].mPosition.y);
   }
 
-  mCanvas->drawPosText(&indices.front(), aBuffer.mNumGlyphs*2, &offsets.front(), paint.mPaint);
+  mCanvas->drawPosText(indices.begin(), aBuffer.mNumGlyphs*2, offsets.begin(), paint.mPaint);
 }
 
 void
@@ -1774,6 +1774,8 @@ void
 GLContext::PlatformStartup()
 {
     RegisterStrongMemoryReporter(new GfxTexturesReporter());
+    RegisterGfxTexturesDistinguishedAmount(
+        GfxTexturesReporter::DistinguishedAmount);
 }
 
 // Common code for checking for both GL extensions and GLX extensions.
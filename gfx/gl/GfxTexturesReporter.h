@@ -48,6 +48,10 @@ public:
       sTileWasteAmount += delta;
     }
 
+    static int64_t DistinguishedAmount() {
+        return sAmount;
+    }
+
     NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
                               nsISupports* aData, bool aAnonymize) override
     {
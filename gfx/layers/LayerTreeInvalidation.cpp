@@ -275,17 +275,30 @@ struct ContainerLayerProperties : public LayerPropertiesBase
     // TODO: Consider how we could avoid unnecessary invalidation when children
     // change order, and whether the overhead would be worth it.
 
-    nsDataHashtable<nsPtrHashKey<Layer>, uint32_t> oldIndexMap(mChildren.Length());
-    for (uint32_t i = 0; i < mChildren.Length(); ++i) {
-      oldIndexMap.Put(mChildren[i]->mLayer, i);
-    }
+    // The child list is usually unchanged, so only build the index map of the
+    // old children once a child is found out of place.
+    nsDataHashtable<nsPtrHashKey<Layer>, uint32_t> oldIndexMap;
+    bool builtOldIndexMap = false;
 
     uint32_t i = 0; // cursor into the old child list mChildren
     for (Layer* child = container->GetFirstChild(); child; child = child->GetNextSibling()) {
       bool invalidateChildsCurrentArea = false;
       if (i < mChildren.Length()) {
         uint32_t childsOldIndex;
-        if (oldIndexMap.Get(child, &childsOldIndex)) {
+        bool isOldChild;
+        if (mChildren[i]->mLayer == child) {
+          childsOldIndex = i;
+          isOldChild = true;
+        } else {
+          if (!builtOldIndexMap) {
+            for (uint32_t j = 0; j < mChildren.Length(); ++j) {
+              oldIndexMap.Put(mChildren[j]->mLayer, j);
+            }
+            builtOldIndexMap = true;
+          }
+          isOldChild = oldIndexMap.Get(child, &childsOldIndex);
+        }
+        if (isOldChild) {
           if (childsOldIndex >= i) {
             // Invalidate the old areas of layers that used to be between the
             // current |child| and the previous |child| that was also in the
@@ -33,6 +33,7 @@
 #include "mozilla/Preferences.h"        // for Preferences
 #include "mozilla/ReentrantMonitor.h"   // for ReentrantMonitorAutoEnter, etc
 #include "mozilla/StaticPtr.h"          // for StaticAutoPtr
+#include "mozilla/Telemetry.h"          // for Telemetry
 #include "mozilla/TimeStamp.h"          // for TimeDuration, TimeStamp
 #include "mozilla/dom/KeyframeEffect.h" // for ComputedTimingFunction
 #include "mozilla/dom/Touch.h"          // for Touch
@@ -822,7 +823,8 @@ AsyncPanZoomController::AsyncPanZoomController(uint64_t aLayersId,
      mTreeManager(aTreeManager),
      mAPZCId(sAsyncPanZoomControllerCount++),
      mSharedLock(nullptr),
-     mAsyncTransformAppliedToContent(false)
+     mAsyncTransformAppliedToContent(false),
+     mCheckerboardSeverity(0)
 {
   if (aGestures == USE_GESTURE_DETECTOR) {
     mGestureEventListener = new GestureEventListener(this);
@@ -2816,18 +2818,49 @@ Matrix4x4 AsyncPanZoomController::GetTransformToLastDispatchedPaint() const {
            PostScale(zoomChange.width, zoomChange.height, 1);
 }
 
-bool AsyncPanZoomController::IsCurrentlyCheckerboarding() const {
-  ReentrantMonitorAutoEnter lock(mMonitor);
+float AsyncPanZoomController::GetCheckerboardedArea() const {
+  mMonitor.AssertCurrentThreadIn();
 
   if (!gfxPrefs::APZAllowCheckerboarding()) {
-    return false;
+    return 0;
   }
 
   CSSPoint currentScrollOffset = mFrameMetrics.GetScrollOffset() + mTestAsyncScrollOffset;
   CSSRect painted = mLastContentPaintMetrics.GetDisplayPort() + mLastContentPaintMetrics.GetScrollOffset();
   painted.Inflate(CSSMargin::FromAppUnits(nsMargin(1, 1, 1, 1)));   // fuzz for rounding error
   CSSRect visible = CSSRect(currentScrollOffset, mFrameMetrics.CalculateCompositedSizeInCssPixels());
-  return !painted.Contains(visible);
+  CSSRect covered = visible.Intersect(painted);
+  return visible.width * visible.height - covered.width * covered.height;
+}
+
+bool AsyncPanZoomController::IsCurrentlyCheckerboarding() const {
+  ReentrantMonitorAutoEnter lock(mMonitor);
+  return GetCheckerboardedArea() > 0;
+}
+
+void AsyncPanZoomController::ReportCheckerboard(const TimeStamp& aSampleTime) {
+  ReentrantMonitorAutoEnter lock(mMonitor);
+
+  float uncoveredArea = GetCheckerboardedArea();
+  if (uncoveredArea > 0) {
+    if (mCheckerboardStart.IsNull()) {
+      mCheckerboardStart = aSampleTime;
+      mCheckerboardSeverity = 0;
+    } else {
+      mCheckerboardSeverity += uncoveredArea *
+        (aSampleTime - mLastCheckerboardSample).ToMilliseconds();
+    }
+    mLastCheckerboardSample = aSampleTime;
+    return;
+  }
+
+  if (!mCheckerboardStart.IsNull()) {
+    Telemetry::Accumulate(Telemetry::CHECKERBOARD_DURATION,
+      uint32_t((aSampleTime - mCheckerboardStart).ToMilliseconds()));
+    Telemetry::Accumulate(Telemetry::CHECKERBOARD_SEVERITY,
+      uint32_t(mCheckerboardSeverity / 1000));
+    mCheckerboardStart = TimeStamp();
+  }
 }
 
 void AsyncPanZoomController::NotifyLayersUpdated(const FrameMetrics& aLayerMetrics, bool aIsFirstPaint) {
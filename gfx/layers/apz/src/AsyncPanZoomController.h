@@ -247,6 +247,13 @@ public:
    */
   bool IsCurrentlyCheckerboarding() const;
 
+  /**
+   * Called by the compositor once per composite to track how long and how
+   * badly we checkerboard. When a checkerboarding episode ends, its duration
+   * and severity are reported to telemetry.
+   */
+  void ReportCheckerboard(const TimeStamp& aSampleTime);
+
   /**
    * Recalculates the displayport. Ideally, this should paint an area bigger
    * than the composite-to dimensions so that when you scroll down, you don't
@@ -1115,6 +1122,21 @@ private:
   // Flag to track whether or not the APZ transform is not used. This
   // flag is recomputed for every composition frame.
   bool mAsyncTransformAppliedToContent;
+
+  /**
+   * Returns the area, in CSS pixels, of the composition bounds that the
+   * last-painted content doesn't cover at the current async scroll offset,
+   * or 0 if checkerboarding is disallowed. The caller must hold mMonitor.
+   */
+  float GetCheckerboardedArea() const;
+
+  // State for the checkerboarding episode in progress, if any; see
+  // ReportCheckerboard.
+  TimeStamp mCheckerboardStart;
+  TimeStamp mLastCheckerboardSample;
+  // Accumulated checkerboarded area (in CSS pixels) times sample interval
+  // (in milliseconds) for the episode in progress.
+  double mCheckerboardSeverity;
 };
 
 } // namespace layers
@@ -20,7 +20,7 @@ namespace layers {
 static void
 ShrinkCallback(nsITimer *aTimer, void *aClosure)
 {
-  static_cast<TextureClientPool*>(aClosure)->ShrinkToMinimumSize();
+  static_cast<TextureClientPool*>(aClosure)->ShrinkTimerFired();
 }
 
 TextureClientPool::TextureClientPool(gfx::SurfaceFormat aFormat,
@@ -33,6 +33,7 @@ TextureClientPool::TextureClientPool(gfx::SurfaceFormat aFormat,
   , mMaxTextureClients(aMaxTextureClients)
   , mShrinkTimeoutMsec(aShrinkTimeoutMsec)
   , mOutstandingClients(0)
+  , mShrinkTimerPending(false)
   , mSurfaceAllocator(aAllocator)
 {
   TCP_LOG("TexturePool %p created with max size %u and timeout %u\n",
@@ -149,8 +150,7 @@ TextureClientPool::ReturnTextureClient(TextureClient *aClient)
   // clients than our desired minimum cache size.
   if (mTextureClients.size() > sMinCacheSize) {
     TCP_LOG("TexturePool %p scheduling a shrink-to-min-size\n", this);
-    mTimer->InitWithFuncCallback(ShrinkCallback, this, mShrinkTimeoutMsec,
-                                 nsITimer::TYPE_ONE_SHOT);
+    ScheduleShrink();
   }
 }
 
@@ -217,6 +217,38 @@ TextureClientPool::ShrinkToMinimumSize()
   }
 }
 
+void
+TextureClientPool::ScheduleShrink()
+{
+  // Clients get returned many times per frame, and re-initializing the timer
+  // each time means a trip to the timer thread. Instead, just note the time
+  // and let ShrinkTimerFired push the deadline out if needed.
+  mLastShrinkRequest = TimeStamp::Now();
+  if (!mShrinkTimerPending) {
+    mShrinkTimerPending = true;
+    mTimer->InitWithFuncCallback(ShrinkCallback, this, mShrinkTimeoutMsec,
+                                 nsITimer::TYPE_ONE_SHOT);
+  }
+}
+
+void
+TextureClientPool::ShrinkTimerFired()
+{
+  mShrinkTimerPending = false;
+
+  TimeDuration timeout = TimeDuration::FromMilliseconds(mShrinkTimeoutMsec);
+  TimeDuration elapsed = TimeStamp::Now() - mLastShrinkRequest;
+  if (elapsed < timeout) {
+    mShrinkTimerPending = true;
+    uint32_t remainingMsec = uint32_t((timeout - elapsed).ToMilliseconds()) + 1;
+    mTimer->InitWithFuncCallback(ShrinkCallback, this, remainingMsec,
+                                 nsITimer::TYPE_ONE_SHOT);
+    return;
+  }
+
+  ShrinkToMinimumSize();
+}
+
 void
 TextureClientPool::ReturnDeferredClients()
 {
@@ -235,8 +267,7 @@ TextureClientPool::ReturnDeferredClients()
   // clients than our desired minimum cache size.
   if (mTextureClients.size() > sMinCacheSize) {
     TCP_LOG("TexturePool %p kicking off shrink-to-min timer\n", this);
-    mTimer->InitWithFuncCallback(ShrinkCallback, this, mShrinkTimeoutMsec,
-                                 nsITimer::TYPE_ONE_SHOT);
+    ScheduleShrink();
   }
 }
 
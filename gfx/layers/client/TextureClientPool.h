@@ -9,6 +9,7 @@
 #include "mozilla/gfx/Types.h"
 #include "mozilla/gfx/Point.h"
 #include "mozilla/RefPtr.h"
+#include "mozilla/TimeStamp.h"
 #include "TextureClient.h"
 #include "nsITimer.h"
 #include <stack>
@@ -85,7 +86,20 @@ public:
 
   gfx::SurfaceFormat GetFormat() { return mFormat; }
 
+  /**
+   * Called when the shrink timer fires. Shrinks the pool to its minimum size,
+   * unless clients were returned since the timer was armed, in which case the
+   * timer is re-armed for the remainder of the timeout.
+   */
+  void ShrinkTimerFired();
+
 private:
+  /**
+   * Arrange for the pool to be shrunk to its minimum size once
+   * mShrinkTimeoutMsec have passed without any further calls to this.
+   */
+  void ScheduleShrink();
+
   // The minimum size of the pool (the number of tiles that will be kept after
   // shrinking).
   static const uint32_t sMinCacheSize = 0;
@@ -115,6 +129,9 @@ private:
   std::stack<RefPtr<TextureClient> > mTextureClients;
   std::stack<RefPtr<TextureClient> > mTextureClientsDeferred;
   nsRefPtr<nsITimer> mTimer;
+  // When ScheduleShrink was last called, and whether mTimer is armed.
+  TimeStamp mLastShrinkRequest;
+  bool mShrinkTimerPending;
   RefPtr<ISurfaceAllocator> mSurfaceAllocator;
 };
 
@@ -496,6 +496,11 @@ SampleAnimations(Layer* aLayer, TimeStamp aPoint)
     SampleValue(portion, animation, animData.mStartValues[segmentIndex],
                 animData.mEndValues[segmentIndex], &interpolatedValue);
     LayerComposite* layerComposite = aLayer->AsLayerComposite();
+    // Only properties that map onto shadow layer attributes can be sampled
+    // here.  Anything else (colors, filters, clips) changes what gets painted
+    // into the layer, so it has to stay on the main thread until the layer
+    // tree can carry those values; nsLayoutUtils::HasAnimationsForCompositor
+    // and the layer's Animatable types limit what gets sent to us.
     switch (animation.property()) {
     case eCSSProperty_opacity:
     {
@@ -645,6 +650,7 @@ AsyncCompositionManager::ApplyAsyncContentTransformToTree(Layer *aLayer)
 
     if (!aLayer->IsScrollInfoLayer()) {
       controller->MarkAsyncTransformAppliedToContent();
+      controller->ReportCheckerboard(TimeStamp::Now());
     }
 
     const FrameMetrics& metrics = aLayer->GetFrameMetrics(i);
@@ -217,9 +217,11 @@ LayerManagerComposite::ApplyOcclusionCulling(Layer* aLayer, nsIntRegion& aOpaque
   }
 
   // Subtract any areas that we know to be opaque from our
-  // visible region.
+  // visible region. Most layers don't overlap the opaque area accumulated so
+  // far at all, so check that before copying and subtracting regions.
   LayerComposite *composite = aLayer->AsLayerComposite();
-  if (!localOpaque.IsEmpty()) {
+  if (!localOpaque.IsEmpty() &&
+      localOpaque.Intersects(composite->GetShadowVisibleRegion().GetBounds())) {
     nsIntRegion visible = composite->GetShadowVisibleRegion();
     visible.Sub(visible, localOpaque);
     composite->SetShadowVisibleRegion(visible);
@@ -31,6 +31,7 @@
 #include "mozilla/layers/PaintedLayerComposite.h"
 #include "mozilla/layers/ShadowLayersManager.h" // for ShadowLayersManager
 #include "mozilla/mozalloc.h"           // for operator delete, etc
+#include "mozilla/Telemetry.h"
 #include "mozilla/unused.h"
 #include "nsCoord.h"                    // for NSAppUnitsToFloatPixels
 #include "nsDebug.h"                    // for NS_RUNTIMEABORT
@@ -235,9 +236,7 @@ LayerTransactionParent::RecvUpdate(InfallibleTArray<Edit>&& cset,
   PROFILER_LABEL("LayerTransactionParent", "RecvUpdate",
     js::ProfileEntry::Category::GRAPHICS);
 
-#ifdef COMPOSITOR_PERFORMANCE_WARNING
   TimeStamp updateStart = TimeStamp::Now();
-#endif
 
   MOZ_LAYERS_LOG(("[ParentSide] received txn with %d edits", cset.Length()));
 
@@ -613,6 +612,11 @@ LayerTransactionParent::RecvUpdate(InfallibleTArray<Edit>&& cset,
     LayerManagerComposite::PlatformSyncBeforeReplyUpdate();
   }
 
+  Telemetry::AccumulateTimeDelta(Telemetry::COMPOSITOR_LAYERS_UPDATE_MS,
+                                 updateStart);
+  Telemetry::Accumulate(Telemetry::COMPOSITOR_LAYERS_UPDATE_EDITS,
+                        cset.Length());
+
 #ifdef COMPOSITOR_PERFORMANCE_WARNING
   int compositeTime = (int)(mozilla::TimeStamp::Now() - updateStart).ToMilliseconds();
   if (compositeTime > 15) {
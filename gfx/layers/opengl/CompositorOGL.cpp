@@ -21,6 +21,7 @@
 #include "gfxUtils.h"                   // for NextPowerOfTwo, gfxUtils, etc
 #include "mozilla/ArrayUtils.h"         // for ArrayLength
 #include "mozilla/Preferences.h"        // for Preferences
+#include "mozilla/Telemetry.h"          // for Accumulate
 #include "mozilla/gfx/BasePoint.h"      // for BasePoint
 #include "mozilla/gfx/Matrix.h"         // for Matrix4x4, Matrix
 #include "mozilla/layers/LayerManagerComposite.h"  // for LayerComposite, etc
@@ -87,6 +88,7 @@ CompositorOGL::CompositorOGL(nsIWidget *aWidget, int aSurfaceWidth,
   , mHasBGRA(0)
   , mUseExternalSurfaceSize(aUseExternalSurfaceSize)
   , mFrameInProgress(false)
+  , mDrawCallsThisFrame(0)
   , mDestroyed(false)
   , mViewportSize(0, 0)
   , mCurrentProgram(nullptr)
@@ -635,6 +637,7 @@ CompositorOGL::BeginFrame(const nsIntRegion& aInvalidRegion,
 
   mPixelsPerFrame = width * height;
   mPixelsFilled = 0;
+  mDrawCallsThisFrame = 0;
 
 #if MOZ_WIDGET_ANDROID
   TexturePoolOGL::Fill(gl());
@@ -1378,6 +1381,9 @@ CompositorOGL::EndFrame()
   mGLContext->SwapBuffers();
   mGLContext->fBindBuffer(LOCAL_GL_ARRAY_BUFFER, 0);
 
+  Telemetry::Accumulate(Telemetry::COMPOSITOR_OGL_DRAW_CALLS,
+                        mDrawCallsThisFrame);
+
   // Unbind all textures
   mGLContext->fActiveTexture(LOCAL_GL_TEXTURE0);
   mGLContext->fBindTexture(LOCAL_GL_TEXTURE_2D, 0);
@@ -1594,6 +1600,7 @@ CompositorOGL::BindAndDrawQuads(ShaderProgramOGL *aProg,
   // We are using GL_TRIANGLES here because the Mac Intel drivers fail to properly
   // process uniform arrays with GL_TRIANGLE_STRIP. Go figure.
   mGLContext->fDrawArrays(LOCAL_GL_TRIANGLES, 0, 6 * aQuads);
+  mDrawCallsThisFrame++;
   LayerScope::SetLayerRects(aQuads, aLayerRects);
 }
 
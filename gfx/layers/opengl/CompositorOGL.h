@@ -371,6 +371,12 @@ private:
    */
   bool mFrameInProgress;
 
+  /**
+   * Number of GL draw calls issued for the frame in progress, reported to
+   * telemetry when the frame is presented.
+   */
+  uint32_t mDrawCallsThisFrame;
+
   /*
    * Clear aRect on current render target.
    */
@@ -30,6 +30,8 @@
 #include "matrix.h"
 #include "transform_util.h"
 
+#define PARAMETRIC_CURVE_TYPE 0x70617261 //'para'
+
 /* for MSVC, GCC, Intel, and Sun compilers */
 #if defined(_M_IX86) || defined(__i386__) || defined(__i386) || defined(_M_AMD64) || defined(__x86_64__) || defined(__x86_64)
 #define X86
@@ -869,6 +871,18 @@ static void qcms_transform_data_rgba_out_lut(qcms_transform *transform, unsigned
 	}
 }
 
+static void qcms_transform_data_rgb_identity(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
+{
+	if (src != dest)
+		memmove(dest, src, length * 3);
+}
+
+static void qcms_transform_data_rgba_identity(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
+{
+	if (src != dest)
+		memmove(dest, src, length * 4);
+}
+
 #if 0
 static void qcms_transform_data_rgb_out_linear(qcms_transform *transform, unsigned char *src, unsigned char *dest, size_t length)
 {
@@ -1206,6 +1220,45 @@ qcms_transform* qcms_transform_precacheLUT_float(qcms_transform *transform, qcms
 
 #define NO_MEM_TRANSFORM NULL
 
+static qcms_bool curves_equal(struct curveType *a, struct curveType *b)
+{
+	static const uint32_t COUNT_TO_LENGTH[5] = {1, 3, 4, 5, 7};
+
+	if (!a || !b)
+		return false;
+	if (a == b)
+		return true;
+	if (a->type != b->type || a->count != b->count)
+		return false;
+	if (a->type == PARAMETRIC_CURVE_TYPE) {
+		if (a->count >= sizeof(COUNT_TO_LENGTH)/sizeof(COUNT_TO_LENGTH[0]))
+			return false;
+		return !memcmp(a->parameter, b->parameter,
+				sizeof(float) * COUNT_TO_LENGTH[a->count]);
+	}
+	return !memcmp(a->data, b->data, sizeof(uInt16Number) * a->count);
+}
+
+static qcms_bool colorants_equal(struct XYZNumber a, struct XYZNumber b)
+{
+	return a.X == b.X && a.Y == b.Y && a.Z == b.Z;
+}
+
+/* A matrix/TRC transform between two profiles with the same colorants and
+ * tone curves only reproduces its input (modulo rounding), which is the
+ * common case of untagged sRGB content on an sRGB display. */
+static qcms_bool is_identity_transform(qcms_profile *in, qcms_profile *out)
+{
+	return in->color_space == RGB_SIGNATURE &&
+		out->color_space == RGB_SIGNATURE &&
+		colorants_equal(in->redColorant, out->redColorant) &&
+		colorants_equal(in->greenColorant, out->greenColorant) &&
+		colorants_equal(in->blueColorant, out->blueColorant) &&
+		curves_equal(in->redTRC, out->redTRC) &&
+		curves_equal(in->greenTRC, out->greenTRC) &&
+		curves_equal(in->blueTRC, out->blueTRC);
+}
+
 qcms_transform* qcms_transform_create(
 		qcms_profile *in, qcms_data_type in_type,
 		qcms_profile *out, qcms_data_type out_type,
@@ -1249,6 +1302,14 @@ qcms_transform* qcms_transform_create(
 		return result;
 	}
 
+	if (in_type == out_type && is_identity_transform(in, out)) {
+		if (in_type == QCMS_DATA_RGB_8)
+			transform->transform_fn = qcms_transform_data_rgb_identity;
+		else
+			transform->transform_fn = qcms_transform_data_rgba_identity;
+		return transform;
+	}
+
 	if (precache) {
 		transform->output_table_r = precache_reference(out->output_table_r);
 		transform->output_table_g = precache_reference(out->output_table_g);
@@ -23,7 +23,12 @@ bool nsRegion::Contains(const nsRegion& aRgn) const
 
 bool nsRegion::Intersects(const nsRect& aRect) const
 {
-  // XXX this could be made faster
+  // Most callers test against regions that don't come anywhere near aRect
+  // (e.g. FrameLayerBuilder walking candidate PaintedLayers), so reject
+  // those using the extents before walking the individual rects.
+  if (!GetBounds().Intersects(aRect)) {
+    return false;
+  }
   nsRegionRectIterator iter(*this);
   while (const nsRect* r = iter.Next()) {
     if (r->Intersects(aRect)) {
@@ -204,6 +204,11 @@ public:
   }
   nsRegion& Sub(const nsRegion& aRegion, const nsRect& aRect)
   {
+    // Invalidation code subtracts lots of rects that miss the region
+    // entirely; skip building a temporary region for those.
+    if (!aRegion.GetBounds().Intersects(aRect)) {
+      return Copy(aRegion);
+    }
     return Sub(aRegion, nsRegion(aRect));
   }
   nsRegion& Sub(const nsRect& aRect, const nsRegion& aRegion)
@@ -459,6 +459,36 @@ void TestVisit(nsRegion &r)
   res.compare(ref);
 }
 
+TEST(Gfx, RegionIntersects)
+{
+  nsRegion r(nsRect(0, 0, 10, 10));
+  r.Or(r, nsRect(90, 90, 10, 10));
+
+  EXPECT_TRUE(r.Intersects(nsRect(5, 5, 10, 10)));
+  EXPECT_TRUE(r.Intersects(nsRect(95, 95, 10, 10)));
+  // Inside the bounds but between the two rects.
+  EXPECT_FALSE(r.Intersects(nsRect(40, 40, 10, 10)));
+  // Entirely outside the bounds.
+  EXPECT_FALSE(r.Intersects(nsRect(200, 0, 10, 10)));
+  EXPECT_FALSE(nsRegion().Intersects(nsRect(0, 0, 10, 10)));
+}
+
+TEST(Gfx, RegionSubRect)
+{
+  nsRegion r(nsRect(0, 0, 100, 100));
+
+  // Disjoint rects leave the region alone, including when done in place.
+  r.SubOut(nsRect(200, 200, 10, 10));
+  EXPECT_TRUE(r.IsEqual(nsRegion(nsRect(0, 0, 100, 100))));
+
+  nsRegion s;
+  s.Sub(r, nsRect(-20, 0, 10, 100));
+  EXPECT_TRUE(s.IsEqual(r));
+
+  s.Sub(r, nsRect(50, 0, 50, 100));
+  EXPECT_TRUE(s.IsEqual(nsRegion(nsRect(0, 0, 50, 100))));
+}
+
 TEST(Gfx, RegionVisitEdges) {
   { // visit edges
     nsRegion r(nsRect(20, 20, 100, 100));
@@ -11,9 +11,11 @@
 #include "mozilla/gfx/2D.h"
 #include "mozilla/gfx/Blur.h"
 #include "mozilla/gfx/PathHelpers.h"
+#include "mozilla/gfx/Tools.h"
 #include "mozilla/UniquePtr.h"
 #include "nsExpirationTracker.h"
 #include "nsClassHashtable.h"
+#include "nsIMemoryReporter.h"
 #include "gfxUtils.h"
 
 using namespace mozilla;
@@ -265,11 +267,13 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData,4>
   public:
     BlurCache()
       : nsExpirationTracker<BlurCacheData, 4>(GENERATION_MS)
+      , mSurfaceBytes(0)
     {
     }
 
     virtual void NotifyExpired(BlurCacheData* aObject)
     {
+      mSurfaceBytes -= SurfaceBytes(aObject->mBlur);
       RemoveObject(aObject);
       mHashEntries.Remove(aObject->mKey);
     }
@@ -305,20 +309,53 @@ class BlurCache final : public nsExpirationTracker<BlurCacheData,4>
         return false;
       }
       mHashEntries.Put(aValue->mKey, aValue);
+      mSurfaceBytes += SurfaceBytes(aValue->mBlur);
       return true;
     }
 
+    size_t GetSurfaceBytes() const
+    {
+      return mSurfaceBytes;
+    }
+
   protected:
+    static size_t SurfaceBytes(SourceSurface* aSurface)
+    {
+      IntSize size = aSurface->GetSize();
+      return size_t(size.width) * size.height *
+             BytesPerPixel(aSurface->GetFormat());
+    }
+
     static const uint32_t GENERATION_MS = 1000;
     /**
      * FIXME use nsTHashtable to avoid duplicating the BlurCacheKey.
      * https://bugzilla.mozilla.org/show_bug.cgi?id=761393#c47
      */
     nsClassHashtable<BlurCacheKey, BlurCacheData> mHashEntries;
+    size_t mSurfaceBytes;
 };
 
 static BlurCache* gBlurCache = nullptr;
 
+class BlurCacheReporter final : public nsIMemoryReporter
+{
+  ~BlurCacheReporter() {}
+
+public:
+  NS_DECL_ISUPPORTS
+
+  NS_IMETHOD CollectReports(nsIHandleReportCallback* aHandleReport,
+                            nsISupports* aData, bool aAnonymize) override
+  {
+    return MOZ_COLLECT_REPORT(
+      "gfx-blur-cache", KIND_OTHER, UNITS_BYTES,
+      gBlurCache ? gBlurCache->GetSurfaceBytes() : 0,
+      "Memory used by the surfaces in the box-shadow blur cache.");
+  }
+};
+
+NS_IMPL_ISUPPORTS(BlurCacheReporter, nsIMemoryReporter)
+
 static IntSize
 ComputeMinSizeForShadowShape(RectCornerRadii* aCornerRadii,
                              gfxIntSize aBlurRadius,
@@ -454,6 +491,11 @@ GetBlur(DrawTarget& aDT,
         IntMargin& aSlice)
 {
   if (!gBlurCache) {
+    static bool sReporterRegistered = false;
+    if (!sReporterRegistered) {
+      RegisterStrongMemoryReporter(new BlurCacheReporter());
+      sReporterRegistered = true;
+    }
     gBlurCache = new BlurCache();
   }
 
@@ -2312,6 +2312,19 @@ gfxFont::AgeCachedWords()
     }
 }
 
+void
+gfxFont::DiscardAgedWords()
+{
+    if (mWordCache) {
+        for (auto it = mWordCache->Iter(); !it.Done(); it.Next()) {
+            CacheHashEntry *entry = it.Get();
+            if (!entry->mShapedWord || entry->mShapedWord->GetAge() > 0) {
+                it.Remove();
+            }
+        }
+    }
+}
+
 void
 gfxFont::NotifyGlyphsChanged()
 {
@@ -2356,8 +2369,14 @@ gfxFont::GetShapedWord(gfxContext *aContext,
     uint32_t wordCacheMaxEntries =
         gfxPlatform::GetPlatform()->WordCacheMaxEntries();
     if (mWordCache->Count() > wordCacheMaxEntries) {
-        NS_WARNING("flushing shaped-word cache");
-        ClearCachedWords();
+        // Drop the words that haven't been used since the last expiration
+        // tick first, so that text still on screen keeps its shaping; only
+        // flush everything if that isn't enough.
+        DiscardAgedWords();
+        if (mWordCache->Count() > wordCacheMaxEntries) {
+            NS_WARNING("flushing shaped-word cache");
+            ClearCachedWords();
+        }
     }
 
     // if there's a cached entry for this word, just return it
@@ -2534,6 +2553,11 @@ gfxFont::PostShapingFixup(gfxContext      *aContext,
 #define BACKTRACK_LIMIT     16 // backtrack this far looking for a good place
                                // to split into fragments for separate shaping
 
+// Note that all shaping, including these long uncached fragments, has to
+// happen on the main thread: the harfbuzz callbacks read glyph advances
+// through the gfxFont (and its DrawTarget-based glyph width cache), and the
+// shaper lazily sets up its hb_font and cmap state, none of which is
+// thread-safe.
 template<typename T>
 bool
 gfxFont::ShapeFragmentWithoutWordCache(gfxContext *aContext,
@@ -1228,6 +1228,9 @@ public:
     uint32_t IncrementAge() {
         return ++mAgeCounter;
     }
+    uint32_t GetAge() const {
+        return mAgeCounter;
+    }
 
     // Helper used when hashing a word for the shaped-word caches
     static uint32_t HashMix(uint32_t aHash, char16_t aCh)
@@ -1713,6 +1716,10 @@ public:
     // so that they'll expire after a sufficient period of non-use
     void AgeCachedWords();
 
+    // Discard the cached words that have not been used since the last
+    // AgeCachedWords() pass; called when the cache overflows.
+    void DiscardAgedWords();
+
     // Discard all cached word records; called on memory-pressure notification.
     void ClearCachedWords() {
         if (mWordCache) {
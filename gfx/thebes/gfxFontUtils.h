@@ -297,7 +297,21 @@ public:
         }
     }
 
+    // Release any blocks that have no bits set (e.g. after ClearRange) and
+    // trim the array, so that equivalent charmaps hash and compare equal.
+    // gfxPlatformFontList::FindCharMap compacts before sharing a charmap.
     void Compact() {
+        uint32_t len = mBlocks.Length();
+        for (uint32_t i = 0; i < len; ++i) {
+            Block *block = mBlocks[i];
+            if (block && IsEmptyBlock(block)) {
+                mBlocks[i] = nullptr;
+            }
+        }
+        while (len > 0 && !mBlocks[len - 1]) {
+            --len;
+        }
+        mBlocks.TruncateLength(len);
         mBlocks.Compact();
     }
 
@@ -314,6 +328,16 @@ public:
     }
 
 private:
+    static bool IsEmptyBlock(const Block *aBlock) {
+        const uint32_t *bits = reinterpret_cast<const uint32_t*>(aBlock->mBits);
+        for (uint32_t j = 0; j < BLOCK_SIZE / 4; ++j) {
+            if (bits[j]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     nsTArray< nsAutoPtr<Block> > mBlocks;
 };
 
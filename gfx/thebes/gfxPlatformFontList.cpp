@@ -847,6 +847,9 @@ gfxPlatformFontList::GetStandardFamilyName(const nsAString& aFontName, nsAString
 gfxCharacterMap*
 gfxPlatformFontList::FindCharMap(gfxCharacterMap *aCmap)
 {
+    // Platform code may have cleared ranges since the cmap was read, so drop
+    // any blocks that left empty before hashing.
+    aCmap->Compact();
     aCmap->CalcHash();
     gfxCharacterMap *cmap = AddCmap(aCmap);
     cmap->mShared = true;
@@ -10,3 +10,4 @@ patch -p3 <convert.patch
 patch -p3 <win64.patch
 patch -p3 <TypeFromSize.patch
 patch -p3 <QuellGccWarnings.patch
+patch -p3 <SkipRowCopy.patch
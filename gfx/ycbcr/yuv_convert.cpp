@@ -284,30 +284,40 @@ NS_GFX_(void) ScaleYCbCrToRGB32(const uint8* y_buf,
     const uint8* u_ptr = u0_ptr;
     const uint8* v_ptr = v0_ptr;
     // Apply vertical filtering if necessary.
-    // TODO(fbarchard): Remove memcpy when not necessary.
+    // The copy into the filter buffers is only needed to pad the row for the
+    // horizontal scalers, which read one pixel past the end. When the row is
+    // not scaled horizontally the source row can be converted in place.
+    bool pad_rows = source_dx != kFractionMax;
     if (filter & mozilla::gfx::FILTER_BILINEAR_V) {
       if (yscale_fixed != kFractionMax &&
           source_y_fraction && ((source_y + 1) < source_height)) {
         FilterRows(ybuf, y0_ptr, y1_ptr, source_width, source_y_fraction);
-      } else {
+        y_ptr = ybuf;
+      } else if (pad_rows) {
         memcpy(ybuf, y0_ptr, source_width);
+        y_ptr = ybuf;
+      }
+      if (pad_rows) {
+        ybuf[source_width] = ybuf[source_width-1];
       }
-      y_ptr = ybuf;
-      ybuf[source_width] = ybuf[source_width-1];
       int uv_source_width = (source_width + 1) / 2;
       if (yscale_fixed != kFractionMax &&
           source_uv_fraction &&
           (((source_y >> y_shift) + 1) < (source_height >> y_shift))) {
         FilterRows(ubuf, u0_ptr, u1_ptr, uv_source_width, source_uv_fraction);
         FilterRows(vbuf, v0_ptr, v1_ptr, uv_source_width, source_uv_fraction);
-      } else {
+        u_ptr = ubuf;
+        v_ptr = vbuf;
+      } else if (pad_rows) {
         memcpy(ubuf, u0_ptr, uv_source_width);
         memcpy(vbuf, v0_ptr, uv_source_width);
+        u_ptr = ubuf;
+        v_ptr = vbuf;
+      }
+      if (pad_rows) {
+        ubuf[uv_source_width] = ubuf[uv_source_width - 1];
+        vbuf[uv_source_width] = vbuf[uv_source_width - 1];
       }
-      u_ptr = ubuf;
-      v_ptr = vbuf;
-      ubuf[uv_source_width] = ubuf[uv_source_width - 1];
-      vbuf[uv_source_width] = vbuf[uv_source_width - 1];
     }
     if (source_dx == kFractionMax) {  // Not scaled
       FastConvertYUVToRGB32Row(y_ptr, u_ptr, v_ptr,
@@ -36,6 +36,7 @@
 #include "gfxContext.h"
 
 #include "mozilla/gfx/2D.h"
+#include "mozilla/CheckedInt.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Likely.h"
 #include "mozilla/RefPtr.h"
@@ -2156,6 +2157,19 @@ RasterImage::FinalizeDecoder(Decoder* aDecoder)
                                (1024 * aDecoder->DecodeTime().ToSeconds()));
         Telemetry::Accumulate(id, KBps);
       }
+
+      // Animated images keep every frame decoded for as long as they're
+      // alive, so record how much that costs. Paletted frames are smaller
+      // than this estimate, and frames with a smaller rect than the image
+      // don't cover its whole area, but those only make it an upper bound.
+      if (mAnim) {
+        CheckedUint32 frameBytes =
+          CheckedUint32(mSize.width) * mSize.height * 4;
+        CheckedUint32 totalKB = frameBytes * mFrameCount / 1024;
+        Telemetry::Accumulate(Telemetry::IMAGE_ANIMATED_DECODED_SIZE_KB,
+                              totalKB.isValid() ? totalKB.value()
+                                                : UINT32_MAX);
+      }
     }
 
     // Detect errors.
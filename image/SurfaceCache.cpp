@@ -395,6 +395,7 @@ public:
     , mAvailableCost(aSurfaceCacheSize)
     , mLockedCost(0)
     , mOverflowCount(0)
+    , mEvictionCount(0)
   {
     nsCOMPtr<nsIObserverService> os = services::GetObserverService();
     if (os) {
@@ -442,6 +443,7 @@ public:
       MOZ_ASSERT(!mCosts.IsEmpty(),
                  "Removed everything and it still won't fit");
       Remove(mCosts.LastElement().GetSurface());
+      mEvictionCount++;
     }
 
     // Locate the appropriate per-image cache. If there's not an existing cache
@@ -814,6 +816,15 @@ public:
                             "surface.");
     NS_ENSURE_SUCCESS(rv, rv);
 
+    rv = MOZ_COLLECT_REPORT("imagelib-surface-cache-eviction-count",
+                            KIND_OTHER, UNITS_COUNT,
+                            mEvictionCount,
+                            "Count of how many unlocked surfaces the surface "
+                            "cache has discarded to make room for new ones. "
+                            "Each of these may have to be decoded again if "
+                            "the image is drawn later.");
+    NS_ENSURE_SUCCESS(rv, rv);
+
     return NS_OK;
   }
 
@@ -913,6 +924,7 @@ private:
   Cost                                    mAvailableCost;
   Cost                                    mLockedCost;
   size_t                                  mOverflowCount;
+  size_t                                  mEvictionCount;
 };
 
 NS_IMPL_ISUPPORTS(SurfaceCacheImpl, nsIMemoryReporter)
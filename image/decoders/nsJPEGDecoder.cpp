@@ -21,6 +21,8 @@
 #include "mozilla/Endian.h"
 #include "mozilla/Telemetry.h"
 
+#include <algorithm>
+
 extern "C" {
 #include "iccjpeg.h"
 }
@@ -80,6 +82,11 @@ METHODDEF(void) my_error_exit (j_common_ptr cinfo);
 // Normal JFIF markers can't have more bytes than this.
 #define MAX_JPEG_MARKER_LENGTH  (((uint32_t)1 << 16) - 1)
 
+// The most scanlines we ask libjpeg for in a single jpeg_read_scanlines call
+// when it's writing straight into the frame buffer. A multiple of the largest
+// row group libjpeg produces (DCTSIZE * max_v_samp_factor).
+static const uint32_t kMaxScanlinesPerRead = 16;
+
 nsJPEGDecoder::nsJPEGDecoder(RasterImage* aImage,
                              Decoder::DecodeStyle aDecodeStyle)
  : Decoder(aImage)
@@ -396,6 +403,27 @@ nsJPEGDecoder::WriteInternal(const char* aBuffer, uint32_t aCount)
     mInfo.buffered_image = mDecodeStyle == PROGRESSIVE &&
                            jpeg_has_multiple_scans(&mInfo);
 
+    if (mDownscaler) {
+      // libjpeg can scale by 1/2, 1/4 or 1/8 while decoding, by dropping DCT
+      // coefficients, which is much cheaper than decoding at full size and
+      // filtering it all away again. Pick the smallest such size that still
+      // leaves the downscaler (which does the high quality part) some
+      // downscaling to do.
+      nsIntSize target = mDownscaler->TargetSize();
+      uint32_t denom = 8;
+      for (; denom > 1; denom /= 2) {
+        nsIntSize scaled((mInfo.image_width + denom - 1) / denom,
+                         (mInfo.image_height + denom - 1) / denom);
+        if (scaled.width >= target.width && scaled.height >= target.height &&
+            scaled != target) {
+          break;
+        }
+      }
+      mInfo.scale_num = 1;
+      mInfo.scale_denom = denom;
+      jpeg_calc_output_dimensions(&mInfo);
+    }
+
     MOZ_ASSERT(!mImageData, "Already have a buffer allocated?");
     nsIntSize targetSize = mDownscaler ? mDownscaler->TargetSize() : GetSize();
     nsresult rv = AllocateFrame(0, targetSize,
@@ -411,7 +439,8 @@ nsJPEGDecoder::WriteInternal(const char* aBuffer, uint32_t aCount)
     MOZ_ASSERT(mImageData, "Should have a buffer now");
 
     if (mDownscaler) {
-      nsresult rv = mDownscaler->BeginFrame(GetSize(),
+      nsIntSize inputSize(mInfo.output_width, mInfo.output_height);
+      nsresult rv = mDownscaler->BeginFrame(inputSize,
                                             mImageData,
                                             /* aHasAlpha = */ false);
       if (NS_FAILED(rv)) {
@@ -619,6 +648,39 @@ nsJPEGDecoder::OutputScanlines(bool* suspend)
 
   const uint32_t top = mInfo.output_scanline;
 
+  // Fast path: when libjpeg can write packed pixels straight into our frame
+  // buffer, let it produce a band of rows per call rather than one. This keeps
+  // its internal row groups (e.g. for 2:1 vertical chroma subsampling) from
+  // being split across calls and saves a round trip through the library per
+  // row on large images.
+  if (mInfo.out_color_space == MOZ_JCS_EXT_NATIVE_ENDIAN_XRGB &&
+      !mDownscaler) {
+    while (mInfo.output_scanline < mInfo.output_height) {
+      JSAMPROW rows[kMaxScanlinesPerRead];
+      uint32_t numRows = std::min<uint32_t>(kMaxScanlinesPerRead,
+                                            mInfo.output_height -
+                                              mInfo.output_scanline);
+      for (uint32_t i = 0; i < numRows; ++i) {
+        rows[i] = reinterpret_cast<JSAMPROW>(
+          reinterpret_cast<uint32_t*>(mImageData) +
+          (mInfo.output_scanline + i) * mInfo.output_width);
+      }
+
+      // Returns the number of rows actually produced; 0 means suspension.
+      if (jpeg_read_scanlines(&mInfo, rows, numRows) == 0) {
+        *suspend = true;
+        break;
+      }
+    }
+
+    if (top != mInfo.output_scanline) {
+      PostInvalidation(nsIntRect(0, top,
+                                 mInfo.output_width,
+                                 mInfo.output_scanline - top));
+    }
+    return;
+  }
+
   while ((mInfo.output_scanline < mInfo.output_height)) {
       uint32_t* imageRow = nullptr;
       if (mDownscaler) {
@@ -722,6 +784,12 @@ nsJPEGDecoder::OutputScanlines(bool* suspend)
 
   if (mDownscaler && mDownscaler->HasInvalidation()) {
     DownscalerInvalidRect invalidRect = mDownscaler->TakeInvalidRect();
+    // The downscaler's input may already have been scaled down by libjpeg;
+    // map its rect back to the image's own coordinate space.
+    double inverseScale = double(mInfo.scale_denom) / mInfo.scale_num;
+    invalidRect.mOriginalSizeRect.ScaleRoundOut(inverseScale, inverseScale);
+    invalidRect.mOriginalSizeRect.IntersectRect(
+      invalidRect.mOriginalSizeRect, nsIntRect(nsIntPoint(), GetSize()));
     PostInvalidation(invalidRect.mOriginalSizeRect,
                      Some(invalidRect.mTargetSizeRect));
     MOZ_ASSERT(!mDownscaler->HasInvalidation());
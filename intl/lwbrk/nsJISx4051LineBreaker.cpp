@@ -504,6 +504,14 @@ GetClass(char16_t u)
    return c;
 }
 
+// Fast path for the Latin-1 characters that make up most Western text.
+// GetClass() recurses for some fullwidth forms, so it is not inlined.
+static inline int8_t
+GetClassInline(char16_t u)
+{
+  return u < 0x0100 ? GETCLASSFROMTABLE(gLBClass00, u) : GetClass(u);
+}
+
 static bool
 GetPair(int8_t c1, int8_t c2)
 {
@@ -842,7 +850,7 @@ nsJISx4051LineBreaker::GetJISx4051Breaks(const char16_t* aChars, uint32_t aLengt
       if (ch == U_EQUAL)
         state.NotifySeenEqualsSign();
       state.NotifyNonHyphenCharacter(ch);
-      cl = GetClass(ch);
+      cl = GetClassInline(ch);
     }
 
     bool allowBreak = false;
@@ -907,7 +915,7 @@ nsJISx4051LineBreaker::GetJISx4051Breaks(const uint8_t* aChars, uint32_t aLength
       if (ch == U_EQUAL)
         state.NotifySeenEqualsSign();
       state.NotifyNonHyphenCharacter(ch);
-      cl = GetClass(ch);
+      cl = GetClassInline(ch);
     }
 
     bool allowBreak = false;
@@ -670,3 +670,23 @@ const char* Pickle::FindNext(uint32_t header_size,
 
   return start + header_size + hdr->payload_size;
 }
+
+// static
+uint32_t Pickle::MessageSize(uint32_t header_size,
+                             const char* start,
+                             const char* end) {
+  DCHECK(header_size == AlignInt(header_size));
+  DCHECK(header_size <= static_cast<memberAlignmentType>(kPayloadUnit));
+
+  if (end < start)
+    return 0;
+  size_t length = static_cast<size_t>(end - start);
+  if (length < sizeof(Header) || length < header_size)
+    return 0;
+
+  const Header* hdr = reinterpret_cast<const Header*>(start);
+  if (hdr->payload_size > std::numeric_limits<uint32_t>::max() - header_size)
+    return 0;
+
+  return header_size + hdr->payload_size;
+}
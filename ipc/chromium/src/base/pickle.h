@@ -282,6 +282,12 @@ class Pickle {
                               const char* range_start,
                               const char* range_end);
 
+  // If the data range holds at least the header of a pickle, return the total
+  // size of that pickle (header and payload).  Otherwise return 0.
+  static uint32_t MessageSize(uint32_t header_size,
+                              const char* range_start,
+                              const char* range_end);
+
   // The allocation granularity of the payload.
   static const int kPayloadUnit;
 
@@ -17,6 +17,7 @@
 #include <sys/un.h>
 #include <sys/uio.h>
 
+#include <algorithm>
 #include <string>
 #include <map>
 
@@ -138,6 +139,10 @@ int ChannelNameToClientFD(const std::string& channel_id) {
   return kClientChannelFd;
 }
 
+// The most we reserve up front for a partially received message, whatever
+// size its header claims.
+const size_t kMaxInputOverflowReserve = 16 * Channel::kReadBufferSize;
+
 //------------------------------------------------------------------------------
 const size_t kMaxPipeNameLength = sizeof(((sockaddr_un*)0)->sun_path);
 
@@ -639,6 +644,17 @@ bool Channel::ChannelImpl::ProcessIncomingMessages() {
       ClearAndShrinkInputOverflowBuf();
     } else if (!overflowp) {
       // p is from input_buf_
+      // If we know how large this message is, make room for it now rather
+      // than regrowing (and recopying) the buffer read by read.  The size
+      // comes from the peer, so don't let it make us allocate more than a
+      // bounded amount ahead of the data actually received; appending
+      // beyond that still grows the buffer geometrically.
+      uint32_t message_size = Message::MessageSize(p, end);
+      if (message_size > static_cast<uint32_t>(end - p) &&
+          message_size <= static_cast<uint32_t>(kMaximumMessageSize)) {
+        input_overflow_buf_.reserve(
+            std::min<size_t>(message_size, kMaxInputOverflowReserve));
+      }
       input_overflow_buf_.assign(p, end - p);
     } else if (p > overflowp) {
       // p is from input_overflow_buf_
@@ -755,6 +755,11 @@ MessageChannel::OnMessageReceivedFromLink(const Message& aMsg)
 
     mPending.push_back(aMsg);
 
+    // How far the worker thread has fallen behind this channel. Each pending
+    // message costs the worker loop one DequeueTask.
+    mozilla::Telemetry::Accumulate(mozilla::Telemetry::IPC_PENDING_QUEUE_LENGTH,
+                                   uint32_t(mPending.size()));
+
     if (shouldWakeUp) {
         NotifyWorkerThread();
     } else {
@@ -10460,8 +10460,9 @@ ParallelCompilationEnabled(ExclusiveContext* cx)
     // off-thread compilation must be enabled. However, since there are a fixed
     // number of helper threads and one is already being consumed by this
     // parsing task, ensure that there another free thread to avoid deadlock.
-    // (Note: there is at most one thread used for parsing so we don't have to
-    // worry about general dining philosophers.)
+    // (Note: GlobalHelperThreadState::maxParseThreads() always leaves a thread
+    // that is not parsing, and only one module is compiled in parallel at a
+    // time, so we don't have to worry about general dining philosophers.)
     if (HelperThreadState().threadCount <= 1 || !CanUseExtraThreads())
         return false;
 
@@ -10647,6 +10648,7 @@ CancelOutstandingJobs(ModuleCompiler& m, ParallelGroupState& group)
 }
 
 static const size_t LIFO_ALLOC_PARALLEL_CHUNK_SIZE = 1 << 12;
+static const size_t TASKS_PER_ASMJS_COMPILATION_THREAD = 2;
 
 static bool
 CheckFunctions(ModuleCompiler& m)
@@ -10662,8 +10664,14 @@ CheckFunctions(ModuleCompiler& m)
 
     JitSpew(JitSpew_IonSyncLogs, "Can't log asm.js script. (Compiled on background thread.)");
 
-    // Saturate all helper threads.
-    size_t numParallelJobs = HelperThreadState().maxAsmJSCompilationThreads();
+    // Saturate all helper threads. Validation and code generation happen on
+    // the main thread, so with only one task per helper thread the main
+    // thread would have to wait for some helper to finish before it could
+    // validate the next function, leaving that helper idle in the meantime.
+    // Keeping more tasks than helpers lets helpers pick up new functions
+    // from the worklist while the main thread is busy.
+    size_t numParallelJobs = HelperThreadState().maxAsmJSCompilationThreads() *
+                             TASKS_PER_ASMJS_COMPILATION_THREAD;
 
     // Allocate scoped AsmJSParallelTask objects. Each contains a unique
     // LifoAlloc that provides all necessary memory for compilation.
@@ -55,6 +55,10 @@
 
 #include "prmjtime.h"
 
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+# include <intrin.h>
+#endif
+
 #include "asmjs/AsmJSModule.h"
 #include "jit/AtomicOperations.h"
 #include "js/Class.h"
@@ -785,6 +789,24 @@ class AutoUnlockFutexAPI
     }
 };
 
+// Number of times futexWait() polls the location before parking.
+static const uint32_t FutexWaitSpinCount = 1000;
+
+// Tells the CPU that we are in a spin-wait loop, so that it can save power
+// and give the resources of the core to a sibling hardware thread.
+static inline void
+FutexSpinPause()
+{
+#if defined(_MSC_VER) && (defined(_M_IX86) || defined(_M_X64))
+    _mm_pause();
+#elif defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+    asm volatile("pause" ::: "memory");
+#elif defined(__GNUC__) && (defined(__aarch64__) || \
+                            (defined(__arm__) && __ARM_ARCH >= 7))
+    asm volatile("yield" ::: "memory");
+#endif
+}
+
 } // namespace js
 
 bool
@@ -829,11 +851,26 @@ js::atomics_futexWait(JSContext* cx, unsigned argc, Value* vp)
         return true;
     }
 
+    int32_t* addr = (int32_t*)view->viewData() + offset;
+
+    // Waits are often short. Parking requires the process-wide futex lock
+    // and a condition variable, so spin on the location for a little while
+    // first. If the value changes meanwhile we can return right away, just
+    // as if this call had started after the change.
+    if (timeout_ms > 0) {
+        for (uint32_t i = 0; i < FutexWaitSpinCount; i++) {
+            if (jit::AtomicOperations::loadSeqCst(addr) != value) {
+                r.setInt32(AtomicsObject::FutexNotequal);
+                return true;
+            }
+            FutexSpinPause();
+        }
+    }
+
     // This lock also protects the "waiters" field on SharedArrayRawBuffer,
     // and it provides the necessary memory fence.
     AutoLockFutexAPI lock;
 
-    int32_t* addr = (int32_t*)view->viewData() + offset;
     if (*addr != value) {
         r.setInt32(AtomicsObject::FutexNotequal);
         return true;
@@ -6,6 +6,7 @@
 
 #include "builtin/MapObject.h"
 
+#include "mozilla/Alignment.h"
 #include "mozilla/Move.h"
 
 #include "jscntxt.h"
@@ -103,6 +104,18 @@ class OrderedHashTable
     Range* ranges;              // list of all live Ranges on this table
     AllocPolicy alloc;
 
+    /*
+     * Storage for the initial hashTable and data arrays. Most Maps and Sets
+     * never grow beyond their initial size, so keeping the first arrays
+     * inline saves two allocations per table. The table itself is always
+     * heap-allocated, so pointers into this storage remain valid.
+     */
+    static const uint32_t InlineBucketsLog2 = 1;
+    static const uint32_t InlineBuckets = 1 << InlineBucketsLog2;
+    static const uint32_t InlineDataCapacity = 5;  // InlineBuckets * fillFactor()
+    Data* inlineHashTable[InlineBuckets];
+    mozilla::AlignedStorage2<Data[InlineDataCapacity]> inlineDataStorage;
+
   public:
     explicit OrderedHashTable(AllocPolicy& ap)
         : hashTable(nullptr), data(nullptr), dataLength(0), ranges(nullptr), alloc(ap) {}
@@ -111,23 +124,17 @@ class OrderedHashTable
         MOZ_ASSERT(!hashTable, "init must be called at most once");
 
         uint32_t buckets = initialBuckets();
-        Data** tableAlloc = alloc.template pod_malloc<Data*>(buckets);
-        if (!tableAlloc)
-            return false;
+        MOZ_ASSERT(buckets == InlineBuckets);
         for (uint32_t i = 0; i < buckets; i++)
-            tableAlloc[i] = nullptr;
+            inlineHashTable[i] = nullptr;
 
         uint32_t capacity = uint32_t(buckets * fillFactor());
-        Data* dataAlloc = alloc.template pod_malloc<Data>(capacity);
-        if (!dataAlloc) {
-            alloc.free_(tableAlloc);
-            return false;
-        }
+        MOZ_ASSERT(capacity == InlineDataCapacity);
 
-        // clear() requires that members are assigned only after all allocation
-        // has succeeded, and that this->ranges is left untouched.
-        hashTable = tableAlloc;
-        data = dataAlloc;
+        // clear() requires that this->ranges is left untouched. It relies on
+        // init() not touching the old arrays, which may be the inline ones.
+        hashTable = inlineHashTable;
+        data = inlineData();
         dataLength = 0;
         dataCapacity = capacity;
         liveCount = 0;
@@ -142,7 +149,7 @@ class OrderedHashTable
             r->onTableDestroyed();
             r = next;
         }
-        alloc.free_(hashTable);
+        freeHashTable(hashTable);
         freeData(data, dataLength);
     }
 
@@ -251,6 +258,13 @@ class OrderedHashTable
             Data* oldData = data;
             uint32_t oldDataLength = dataLength;
 
+            if (oldData == inlineData()) {
+                // The inline arrays are about to be reused, so destroy the old
+                // entries in place first.
+                destroyData(oldData, oldDataLength);
+                oldDataLength = 0;
+            }
+
             hashTable = nullptr;
             if (!init()) {
                 // init() only mutates members on success; see comment above.
@@ -258,7 +272,7 @@ class OrderedHashTable
                 return false;
             }
 
-            alloc.free_(oldHashTable);
+            freeHashTable(oldHashTable);
             freeData(oldData, oldDataLength);
             for (Range* r = ranges; r; r = r->next)
                 r->onClear();
@@ -530,7 +544,7 @@ class OrderedHashTable
 
   private:
     /* Logarithm base 2 of the number of buckets in the hash table initially. */
-    static uint32_t initialBucketsLog2() { return 1; }
+    static uint32_t initialBucketsLog2() { return InlineBucketsLog2; }
     static uint32_t initialBuckets() { return 1 << initialBucketsLog2(); }
 
     /*
@@ -565,9 +579,19 @@ class OrderedHashTable
             (--p)->~Data();
     }
 
+    Data* inlineData() {
+        return *inlineDataStorage.addr();
+    }
+
+    void freeHashTable(Data** table) {
+        if (table != inlineHashTable)
+            alloc.free_(table);
+    }
+
     void freeData(Data* data, uint32_t length) {
         destroyData(data, length);
-        alloc.free_(data);
+        if (data != inlineData())
+            alloc.free_(data);
     }
 
     Data* lookup(const Lookup& l, HashNumber h) {
@@ -655,7 +679,7 @@ class OrderedHashTable
         }
         MOZ_ASSERT(wp == newData + liveCount);
 
-        alloc.free_(hashTable);
+        freeHashTable(hashTable);
         freeData(data, dataLength);
 
         hashTable = newHashTable;
@@ -6071,20 +6071,35 @@ struct AutoValue
 
   ~AutoValue()
   {
-    js_free(mData);
+    if (mData != &mInlineData)
+      js_free(mData);
   }
 
   bool SizeToType(JSContext* cx, JSObject* type)
   {
     // Allocate a minimum of sizeof(ffi_arg) to handle small integers.
     size_t size = Align(CType::GetSize(type), sizeof(ffi_arg));
-    mData = js_malloc(size);
+    // Arguments and return values are nearly always scalars or pointers, so
+    // keep small ones inline rather than doing a heap allocation for each of
+    // them on every call. This means an AutoValue must not be moved once it
+    // has been sized.
+    if (size <= sizeof(mInlineData))
+      mData = &mInlineData;
+    else
+      mData = js_malloc(size);
     if (mData)
       memset(mData, 0, size);
     return mData != nullptr;
   }
 
   void* mData;
+
+private:
+  union {
+    long double mLongDouble;
+    uint64_t mWords[2];
+    void* mPointer;
+  } mInlineData;
 };
 
 static bool
@@ -6608,6 +6623,16 @@ FunctionType::Call(JSContext* cx,
       return false;
   }
 
+  // AutoValue isn't pointer-sized, since it may hold the value inline, so
+  // ffi_call needs a separate array of pointers to the argument values.
+  Array<void*, 16> argPointers;
+  if (!argPointers.resize(args.length())) {
+    JS_ReportOutOfMemory(cx);
+    return false;
+  }
+  for (uint32_t i = 0; i < args.length(); ++i)
+    argPointers[i] = values[i].mData;
+
   // initialize a pointer to an appropriate location, for storing the result
   AutoValue returnValue;
   TypeCode typeCode = CType::GetTypeCode(fninfo->mReturnType);
@@ -6632,7 +6657,7 @@ FunctionType::Call(JSContext* cx,
   errno = 0;
 
   ffi_call(&fninfo->mCIF, FFI_FN(fn), returnValue.mData,
-           reinterpret_cast<void**>(values.begin()));
+           argPointers.begin());
 
   // Save error value.
   // We need to save it before leaving the scope of |suspend| as destructing
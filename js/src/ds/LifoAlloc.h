@@ -348,6 +348,14 @@ class LifoAlloc
             latest->resetBump();
     }
 
+    // Like releaseAll(), but for a LifoAlloc whose marks are owned by objects
+    // allocated within it, which are dead along with everything else in it.
+    // The chunks are kept so they can be reused by another user.
+    void releaseAllForReuse() {
+        markCount = 0;
+        releaseAll();
+    }
+
     // Get the total "used" (occupied bytes) count for the arena chunks.
     size_t used() const {
         size_t accum = 0;
@@ -1104,6 +1104,28 @@ static const uint8_t firstCharKinds[] = {
 static_assert(LastCharKind < (1 << (sizeof(firstCharKinds[0]) * 8)),
               "Elements of firstCharKinds[] are too small");
 
+// Skip a run of ASCII identifier chars starting at |p|.  Identifiers are
+// almost always pure ASCII, so handling them with a tight pointer loop avoids
+// the per-char EOF and Unicode checks of getCharIgnoreEOL() and
+// IsIdentifierPart().  The slow loop below picks up whatever stops this one.
+static MOZ_ALWAYS_INLINE const char16_t*
+SkipASCIIIdentifierParts(const char16_t* p, const char16_t* limit)
+{
+    while (p < limit && *p < 128 && js_isident[*p])
+        p++;
+    return p;
+}
+
+// Likewise for runs of the indentation chars ' ' and '\t', which make up
+// most of the whitespace in unminified code.
+static MOZ_ALWAYS_INLINE const char16_t*
+SkipASCIISpaces(const char16_t* p, const char16_t* limit)
+{
+    while (p < limit && (*p == ' ' || *p == '\t'))
+        p++;
+    return p;
+}
+
 bool
 TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
 {
@@ -1196,8 +1218,11 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
 
     // Skip over non-EOL whitespace chars.
     //
-    if (c1kind == Space)
+    if (c1kind == Space) {
+        userbuf.setAddressOfNextRawChar(SkipASCIISpaces(userbuf.addressOfNextRawChar(),
+                                                        userbuf.limit()));
         goto retry;
+    }
 
     // Look for an identifier.
     //
@@ -1208,6 +1233,8 @@ TokenStream::getTokenInternal(TokenKind* ttp, Modifier modifier)
 
       identifier:
         for (;;) {
+            userbuf.setAddressOfNextRawChar(SkipASCIIIdentifierParts(userbuf.addressOfNextRawChar(),
+                                                                     userbuf.limit()));
             c = getCharIgnoreEOL();
             if (c == EOF)
                 break;
@@ -8,6 +8,7 @@
 #define gc_GCInternals_h
 
 #include "mozilla/ArrayUtils.h"
+#include "mozilla/HashFunctions.h"
 #include "mozilla/PodOperations.h"
 
 #include "jscntxt.h"
@@ -211,14 +212,32 @@ struct TenureCount
 // Keep rough track of how many times we tenure objects in particular groups
 // during minor collections, using a fixed size hash for efficiency at the cost
 // of potential collisions.
+//
+// Each group may live in one of two adjacent entries, so that a pair of hot
+// groups that hash to the same place are both counted instead of whichever
+// got there first hiding the other from pretenuring.
 struct TenureCountCache
 {
-    TenureCount entries[16];
+    static const size_t EntryShift = 6;
+    static const size_t EntryCount = 1 << EntryShift;
+
+    TenureCount entries[EntryCount];
 
     TenureCountCache() { mozilla::PodZero(this); }
 
+    // Return the entry counting |group|, or a free entry it may claim, or an
+    // entry belonging to another group if both candidates are taken.
     TenureCount& findEntry(ObjectGroup* group) {
-        return entries[PointerHasher<ObjectGroup*, 3>::hash(group) % mozilla::ArrayLength(entries)];
+        // Groups are GC things whose low address bits are always zero, so
+        // scramble the address rather than taking it modulo the table size.
+        size_t index = mozilla::HashGeneric(group) >> (32 - EntryShift);
+        TenureCount& primary = entries[index];
+        if (primary.group == group || !primary.group)
+            return primary;
+        TenureCount& secondary = entries[index ^ 1];
+        if (secondary.group == group || !secondary.group)
+            return secondary;
+        return primary;
     }
 };
 
@@ -635,14 +635,78 @@ js::Nursery::waitBackgroundFreeEnd()
     freeMallocedBuffersTask->join();
 }
 
+#if defined(JS_CRASH_DIAGNOSTICS) || defined(JS_GC_ZEAL)
+class NurseryPoisonTask : public GCParallelTask
+{
+  public:
+    NurseryPoisonTask() : start_(nullptr), size_(0) {}
+    ~NurseryPoisonTask() override { join(); }
+
+    void init(void* start, size_t size) {
+        start_ = start;
+        size_ = size;
+    }
+
+  private:
+    void* start_;
+    size_t size_;
+
+    virtual void run() override {
+        JS_POISON(start_, JS_SWEPT_NURSERY_PATTERN, size_);
+    }
+};
+
+void
+js::Nursery::poisonChunks(int count)
+{
+    MOZ_ASSERT(count > 0 && count <= numNurseryChunks_);
+
+    // Poisoning touches every byte of every used chunk and dominates the
+    // sweep for large nurseries, so split it into contiguous runs of chunks.
+    // The main thread poisons the first run while helpers take the rest.
+    static const size_t MaxTasks = 8;
+    size_t shares = 1;
+    if (CanUseExtraThreads())
+        shares = Min(Min(HelperThreadState().cpuCount, size_t(count)), MaxTasks + 1);
+    size_t chunksPerShare = (size_t(count) + shares - 1) / shares;
+
+    NurseryPoisonTask tasks[MaxTasks];
+    bool started[MaxTasks] = { false };
+    size_t taskCount = 0;
+    {
+        AutoLockHelperThreadState lock;
+        for (size_t first = chunksPerShare; first < size_t(count); first += chunksPerShare) {
+            size_t n = Min(chunksPerShare, size_t(count) - first);
+            tasks[taskCount].init(&chunk(first), n * ChunkSize);
+            started[taskCount] = tasks[taskCount].startWithLockHeld();
+            taskCount++;
+        }
+    }
+
+    JS_POISON(&chunk(0), JS_SWEPT_NURSERY_PATTERN, Min(chunksPerShare, size_t(count)) * ChunkSize);
+
+    for (size_t i = 0; i < taskCount; i++) {
+        if (!started[i])
+            tasks[i].runFromMainThread(runtime());
+    }
+
+    {
+        AutoLockHelperThreadState lock;
+        for (size_t i = 0; i < taskCount; i++)
+            tasks[i].joinWithLockHeld();
+    }
+
+    for (int i = 0; i < count; ++i)
+        initChunk(i);
+}
+#endif
+
 void
 js::Nursery::sweep()
 {
 #ifdef JS_GC_ZEAL
     /* Poison the nursery contents so touching a freed object will crash. */
-    JS_POISON((void*)start(), JS_SWEPT_NURSERY_PATTERN, nurserySize());
-    for (int i = 0; i < numNurseryChunks_; ++i)
-        initChunk(i);
+    poisonChunks(numNurseryChunks_);
 
     if (runtime()->gcZeal() == ZealGenerationalGCValue) {
         MOZ_ASSERT(numActiveChunks_ == numNurseryChunks_);
@@ -654,11 +718,11 @@ js::Nursery::sweep()
 #endif
     {
 #ifdef JS_CRASH_DIAGNOSTICS
-        JS_POISON((void*)start(), JS_SWEPT_NURSERY_PATTERN, allocationEnd() - start());
-        for (int i = 0; i < numActiveChunks_; ++i) {
-            chunk(i).trailer.location = gc::ChunkLocationBitNursery;
-            chunk(i).trailer.runtime = runtime();
-        }
+        /*
+         * Only chunks up to the current one have been allocated from since
+         * the last sweep; the rest are still poisoned or freshly committed.
+         */
+        poisonChunks(currentChunk_ + 1);
 #endif
         setCurrentChunk(0);
     }
@@ -351,6 +351,13 @@ class Nursery
      */
     void sweep();
 
+    /*
+     * Poison the first |count| chunks of the nursery, splitting the work
+     * between the main thread and helper threads, and re-initialize their
+     * trailers.
+     */
+    void poisonChunks(int count);
+
     /* Change the allocable space provided by the nursery. */
     void growAllocableSpace();
     void shrinkAllocableSpace();
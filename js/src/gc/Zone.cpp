@@ -12,6 +12,7 @@
 #include "jit/Ion.h"
 #include "jit/JitCompartment.h"
 #include "vm/Debugger.h"
+#include "vm/RegExpObject.h"
 #include "vm/Runtime.h"
 
 #include "jscompartmentinlines.h"
@@ -37,6 +38,7 @@ JS::Zone::Zone(JSRuntime* rt)
     isSystem(false),
     usedByExclusiveThread(false),
     active(false),
+    regExps_(nullptr),
     jitZone_(nullptr),
     gcState_(NoGC),
     gcScheduled_(false),
@@ -59,13 +61,31 @@ Zone::~Zone()
         rt->gc.systemZone = nullptr;
 
     js_delete(debuggers);
+    js_delete(regExps_);
     js_delete(jitZone_);
 }
 
 bool Zone::init(bool isSystemArg)
 {
     isSystem = isSystemArg;
-    return gcZoneGroupEdges.init();
+
+    regExps_ = js_new<RegExpZone>(runtimeFromAnyThread());
+    if (!regExps_ || !regExps_->init())
+        return false;
+
+    return gcZoneGroupEdges.init() && atomCache_.init();
+}
+
+void
+Zone::purgeAtomCache(bool releaseMemory)
+{
+    MOZ_ASSERT(!usedByExclusiveThread);
+    if (releaseMemory)
+        atomCache_.finish();
+    if (atomCache_.initialized())
+        atomCache_.clear();
+    else
+        (void) atomCache_.init();
 }
 
 void
@@ -20,6 +20,8 @@
 
 namespace js {
 
+class RegExpZone;
+
 namespace jit {
 class JitZone;
 } // namespace jit
@@ -118,7 +120,9 @@ struct Zone : public JS::shadow::Zone,
 
     void addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
                                 size_t* typePool,
-                                size_t* baselineStubsOptimized);
+                                size_t* baselineStubsOptimized,
+                                size_t* regexpZone,
+                                size_t* atomCache);
 
     void resetGCMallocBytes();
     void setGCMaxMallocBytes(size_t value);
@@ -219,6 +223,8 @@ struct Zone : public JS::shadow::Zone,
     void setNeedsIncrementalBarrier(bool needs, ShouldUpdateJit updateJit);
     const bool* addressOfNeedsIncrementalBarrier() const { return &needsIncrementalBarrier_; }
 
+    js::RegExpZone& regExps() { return *regExps_; }
+
     js::jit::JitZone* getJitZone(JSContext* cx) { return jitZone_ ? jitZone_ : createJitZone(cx); }
     js::jit::JitZone* jitZone() { return jitZone_; }
 
@@ -307,6 +313,19 @@ struct Zone : public JS::shadow::Zone,
     // Per-zone data for use by an embedder.
     void* data;
 
+    // Atoms looked up by code running in this zone. A zone is only used by a
+    // single thread at a time, so lookups here need neither the exclusive
+    // access lock nor a probe of the runtime's atoms table. The cache is
+    // cleared whenever the zone is collected, which is the only time atoms
+    // can die. Once it holds AtomCacheMaxEntries atoms, no more are added
+    // until the next purge.
+    js::AtomSet& atomCache() { return atomCache_; }
+    static const uint32_t AtomCacheMaxEntries = 4096;
+
+    // Clears the cache. With |releaseMemory| its storage is freed too; if it
+    // can't be reallocated, the cache is disabled until the next purge.
+    void purgeAtomCache(bool releaseMemory = false);
+
     bool isSystem;
 
     bool usedByExclusiveThread;
@@ -317,6 +336,10 @@ struct Zone : public JS::shadow::Zone,
     mozilla::DebugOnly<unsigned> gcLastZoneGroupIndex;
 
   private:
+    js::AtomSet atomCache_;
+
+    js::RegExpZone* regExps_;
+
     js::jit::JitZone* jitZone_;
 
     GCState gcState_;
@@ -0,0 +1,103 @@
+// Arrays of int32s sorted with an 'a - b' or 'b - a' comparator take a radix
+// sort once they have MinRadixSortLength (256) elements.  Check the result
+// against a sort with a comparator that isn't recognized as numeric.
+
+var INT32_MIN = -0x80000000;
+var INT32_MAX = 0x7fffffff;
+
+var seed = 1;
+function random() {
+    seed = (seed * 1103515245 + 12345) % 0x80000000;
+    return seed;
+}
+
+function ascending(a, b) {
+    return a < b ? -1 : a > b ? 1 : 0;
+}
+function descending(a, b) {
+    return a < b ? 1 : a > b ? -1 : 0;
+}
+
+function check(arr) {
+    var up = arr.slice().sort(function (a, b) { return a - b; });
+    assertEq(up.length, arr.length);
+    assertEq(up.toString(), arr.slice().sort(ascending).toString());
+
+    var down = arr.slice().sort(function (a, b) { return b - a; });
+    assertEq(down.length, arr.length);
+    assertEq(down.toString(), arr.slice().sort(descending).toString());
+}
+
+// Mixed signs and the int32 extremes.
+function mixed(len) {
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push((random() | 0) - 0x40000000);
+    arr[0] = INT32_MIN;
+    arr[len >> 1] = INT32_MAX;
+    arr[len - 1] = -1;
+    arr[len - 2] = 0;
+    arr.push(INT32_MIN, INT32_MAX, INT32_MIN, INT32_MAX);
+    return arr;
+}
+
+// Only negative numbers.
+function negative(len) {
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push(-(random() % 100000) - 1);
+    return arr;
+}
+
+// Many duplicates of a few values, including the extremes.
+function duplicates(len) {
+    var values = [INT32_MIN, -7, -1, 0, 1, 7, INT32_MAX];
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push(values[random() % values.length]);
+    return arr;
+}
+
+// Keys that only differ in one byte, so the other passes are skipped.
+function oneByte(len) {
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push(0x12340000 | ((random() & 0xff) << 8));
+    return arr;
+}
+
+// Already sorted, reversed, and all equal.
+function sorted(len) {
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push(i - (len >> 1));
+    return arr;
+}
+function reversed(len) {
+    return sorted(len).reverse();
+}
+function equal(len) {
+    var arr = [];
+    for (var i = 0; i < len; i++)
+        arr.push(-42);
+    return arr;
+}
+
+var generators = [mixed, negative, duplicates, oneByte, sorted, reversed, equal];
+var lengths = [255, 256, 257, 1000, 5000];
+for (var g = 0; g < generators.length; g++) {
+    for (var l = 0; l < lengths.length; l++)
+        check(generators[g](lengths[l]));
+}
+
+// Holes and undefined values go to the end, after the sorted int32s.
+var holey = mixed(300);
+holey.length = 310;
+holey[305] = undefined;
+holey.sort(function (a, b) { return a - b; });
+assertEq(holey.length, 310);
+for (var i = 1; i < 304; i++)
+    assertEq(holey[i - 1] <= holey[i], true);
+assertEq(holey[304], undefined);
+assertEq(304 in holey, true);
+assertEq(305 in holey, false);
@@ -0,0 +1,61 @@
+// Copy-on-write array literals which are only read are scalar replaced by
+// Ion.  Writes after a bailout or after the array escapes must go to a
+// private copy, and never to the elements shared with the template object.
+
+setJitCompilerOption("baseline.warmup.trigger", 10);
+setJitCompilerOption("ion.warmup.trigger", 20);
+
+var uceFault = function (i) {
+    if (i > 98)
+        uceFault = function (i) { return true; };
+    return false;
+};
+
+// The array is recovered on bailout, then written to.  (No
+// assertRecoveredOnBailout here: whether the writes in the never-taken branch
+// keep the array from being scalar replaced is up to Ion.)
+var uceFault_bailout = eval(uneval(uceFault).replace('uceFault', 'uceFault_bailout'));
+function bailoutThenWrite(i) {
+    var a = [1, 2, 3];
+    var x = a[0] + a[2];
+    if (uceFault_bailout(i) || uceFault_bailout(i)) {
+        a[0] = i;
+        assertEq(a[0], i);
+        assertEq(a.length, 3);
+    }
+    return x;
+}
+
+// Same, but the recovered array grows.
+var uceFault_push = eval(uneval(uceFault).replace('uceFault', 'uceFault_push'));
+function bailoutThenPush(i) {
+    var a = [1, 2, 3];
+    var x = a.length;
+    if (uceFault_push(i) || uceFault_push(i)) {
+        a.push(i);
+        assertEq(a.length, 4);
+        assertEq(a[3], i);
+    }
+    return x;
+}
+
+// The array escapes, so it is not scalar replaced, and is written to.
+function identity(x) {
+    return x;
+}
+function escapeThenWrite(i) {
+    var a = [1, 2, 3];
+    var x = a[1];
+    var b = identity(a);
+    b[1] = i;
+    assertEq(a[1], i);
+    return x;
+}
+
+for (var i = 0; i < 100; i++) {
+    // If any of the writes above had gone to the shared elements, the next
+    // literal would read the written values instead.
+    assertEq(bailoutThenWrite(i), 4);
+    assertEq(bailoutThenPush(i), 3);
+    assertEq(escapeThenWrite(i), 2);
+}
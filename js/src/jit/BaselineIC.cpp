@@ -6718,6 +6718,26 @@ TryAttachNativeGetAccessorPropStub(JSContext* cx, HandleScript script, jsbytecod
         return true;
     }
 
+    // For all other proxies except outer windows, attach a single stub which
+    // calls Proxy::get directly instead of going through the fallback path.
+    if (!isDOMProxy && obj->is<ProxyObject>() && GetInnerObject(obj) == obj) {
+#if JS_HAS_NO_SUCH_METHOD
+        if (isCallProp)
+            return true;
+#endif
+        if (stub->hasStub(ICStub::GetProp_GenericProxy))
+            return true;
+
+        JitSpew(JitSpew_BaselineIC, "  Generating GetProp(GenericProxy) stub");
+        ICGetProp_GenericProxy::Compiler compiler(cx, monitorStub, name);
+        ICStub* newStub = compiler.getStub(compiler.getStubSpace(script));
+        if (!newStub)
+            return false;
+        stub->addNewStub(newStub);
+        *attached = true;
+        return true;
+    }
+
     const Class* outerClass = nullptr;
     if (!isDOMProxy && !obj->isNative()) {
         outerClass = obj->getClass();
@@ -7935,6 +7955,54 @@ ICGetProp_DOMProxyShadowed::Compiler::generateStubCode(MacroAssembler& masm)
     return true;
 }
 
+bool
+ICGetProp_GenericProxy::Compiler::generateStubCode(MacroAssembler& masm)
+{
+    MOZ_ASSERT(engine_ == Engine::Baseline);
+
+    Label failure;
+
+    AllocatableGeneralRegisterSet regs(availableGeneralRegs(1));
+    Register scratch = regs.takeAnyExcluding(ICTailCallReg);
+
+    // Guard input is an object.
+    masm.branchTestObject(Assembler::NotEqual, R0, &failure);
+
+    // Unbox.
+    Register objReg = masm.extractObject(R0, ExtractTemp0);
+
+    // Guard that the object is a proxy, but not a DOM proxy, so the more
+    // specialized DOM proxy stubs still get a chance to attach.
+    masm.branchTestObjectIsProxy(false, objReg, scratch, &failure);
+    masm.branchTestProxyHandlerFamily(Assembler::Equal, objReg, scratch,
+                                      GetDOMProxyHandlerFamily(), &failure);
+
+    // Call ProxyGet(JSContext* cx, HandleObject proxy, HandlePropertyName name, MutableHandleValue vp);
+
+    // Push a stub frame so that we can perform a non-tail call.
+    enterStubFrame(masm, scratch);
+
+    // Push property name and proxy object.
+    masm.loadPtr(Address(ICStubReg, ICGetProp_GenericProxy::offsetOfName()), scratch);
+    masm.push(scratch);
+    masm.push(objReg);
+
+    // Don't have to preserve R0 anymore.
+    regs.add(R0);
+
+    if (!callVM(ProxyGetInfo, masm))
+        return false;
+    leaveStubFrame(masm);
+
+    // Enter type monitor IC to type-check result.
+    EmitEnterTypeMonitorIC(masm);
+
+    // Failure case - jump to next stub
+    masm.bind(&failure);
+    EmitStubGuardFailure(masm);
+    return true;
+}
+
 bool
 ICGetProp_ArgumentsLength::Compiler::generateStubCode(MacroAssembler& masm)
 {
@@ -12643,6 +12711,14 @@ ICGetProp_DOMProxyShadowed::Clone(JSContext* cx, ICStubSpace* space, ICStub* fir
                                            other.pcOffset_);
 }
 
+/* static */ ICGetProp_GenericProxy*
+ICGetProp_GenericProxy::Clone(JSContext* cx, ICStubSpace* space, ICStub* firstMonitorStub,
+                              ICGetProp_GenericProxy& other)
+{
+    return New<ICGetProp_GenericProxy>(cx, space, other.jitCode(), firstMonitorStub,
+                                       other.name_);
+}
+
 //
 // Rest_Fallback
 //
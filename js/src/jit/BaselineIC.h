@@ -3794,6 +3794,53 @@ class ICGetProp_DOMProxyShadowed : public ICMonitoredStub
     };
 };
 
+// Stub for calling Proxy::get on any proxy that is not a DOM proxy, e.g.
+// scripted proxies and wrappers. One such stub covers all of these proxies,
+// regardless of their handler or shape.
+class ICGetProp_GenericProxy : public ICMonitoredStub
+{
+  friend class ICStubSpace;
+  protected:
+    HeapPtrPropertyName name_;
+
+    ICGetProp_GenericProxy(JitCode* stubCode, ICStub* firstMonitorStub, PropertyName* name)
+      : ICMonitoredStub(ICStub::GetProp_GenericProxy, stubCode, firstMonitorStub),
+        name_(name)
+    {}
+
+  public:
+    static ICGetProp_GenericProxy* Clone(JSContext* cx, ICStubSpace* space,
+                                         ICStub* firstMonitorStub,
+                                         ICGetProp_GenericProxy& other);
+
+    HeapPtrPropertyName& name() {
+        return name_;
+    }
+
+    static size_t offsetOfName() {
+        return offsetof(ICGetProp_GenericProxy, name_);
+    }
+
+    class Compiler : public ICStubCompiler {
+        ICStub* firstMonitorStub_;
+        RootedPropertyName name_;
+
+        bool generateStubCode(MacroAssembler& masm);
+
+      public:
+        Compiler(JSContext* cx, ICStub* firstMonitorStub, HandlePropertyName name)
+          : ICStubCompiler(cx, ICStub::GetProp_GenericProxy, Engine::Baseline),
+            firstMonitorStub_(firstMonitorStub),
+            name_(cx, name)
+        {}
+
+        ICStub* getStub(ICStubSpace* space) {
+            return newStub<ICGetProp_GenericProxy>(space, getStubCode(), firstMonitorStub_,
+                                                   name_);
+        }
+    };
+};
+
 class ICGetProp_ArgumentsLength : public ICStub
 {
   friend class ICStubSpace;
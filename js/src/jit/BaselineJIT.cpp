@@ -242,8 +242,12 @@ jit::BaselineCompile(JSContext* cx, JSScript* script, bool forceDebugInstrumenta
 
     script->ensureNonLazyCanonicalFunction(cx);
 
-    LifoAlloc alloc(TempAllocator::PreferredLifoChunkSize);
-    TempAllocator* temp = alloc.new_<TempAllocator>(&alloc);
+    // Baseline compilations are frequent and short-lived, so take the
+    // compiler's scratch memory from the runtime's temp LifoAlloc, whose
+    // chunks survive between compilations, instead of mallocing and freeing
+    // a fresh set of chunks for every script that warms up.
+    LifoAllocScope las(&cx->tempLifoAlloc());
+    TempAllocator* temp = las.alloc().new_<TempAllocator>(&las.alloc());
     if (!temp) {
         ReportOutOfMemory(cx);
         return Method_Error;
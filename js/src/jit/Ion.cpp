@@ -12,6 +12,7 @@
 
 #include "jscompartment.h"
 #include "jsprf.h"
+#include "prmjtime.h"
 
 #include "gc/Marking.h"
 #include "jit/AliasAnalysis.h"
@@ -176,6 +177,7 @@ JitRuntime::~JitRuntime()
 {
     js_delete(functionWrappers_);
     freeOsrTempData();
+    purgeIonLifoAllocCache();
 
     // By this point, the jitcode global table should be empty.
     MOZ_ASSERT_IF(jitcodeGlobalTable_, jitcodeGlobalTable_->empty());
@@ -339,6 +341,46 @@ JitRuntime::freeOsrTempData()
     osrTempData_ = nullptr;
 }
 
+LifoAlloc*
+JitRuntime::newIonLifoAlloc(JSContext* cx)
+{
+    if (!ionLifoAllocCache_.empty())
+        return ionLifoAllocCache_.popCopy();
+    return cx->new_<LifoAlloc>(TempAllocator::PreferredLifoChunkSize);
+}
+
+void
+JitRuntime::recycleIonLifoAlloc(LifoAlloc* alloc)
+{
+    // Everything allocated in |alloc|, including the TempAllocator holding a
+    // mark on it, belongs to the finished compilation.
+    alloc->releaseAllForReuse();
+    alloc->freeAllIfHugeAndUnused();
+
+    if (ionLifoAllocCache_.length() == MaxCachedIonLifoAllocs ||
+        !ionLifoAllocCache_.append(alloc))
+    {
+        js_delete(alloc);
+    }
+}
+
+void
+JitRuntime::purgeIonLifoAllocCache()
+{
+    for (size_t i = 0; i < ionLifoAllocCache_.length(); i++)
+        js_delete(ionLifoAllocCache_[i]);
+    ionLifoAllocCache_.clear();
+}
+
+size_t
+JitRuntime::sizeOfIonLifoAllocCache(mozilla::MallocSizeOf mallocSizeOf) const
+{
+    size_t n = ionLifoAllocCache_.sizeOfExcludingThis(mallocSizeOf);
+    for (size_t i = 0; i < ionLifoAllocCache_.length(); i++)
+        n += ionLifoAllocCache_[i]->sizeOfIncludingThis(mallocSizeOf);
+    return n;
+}
+
 void
 JitRuntime::patchIonBackedges(JSRuntime* rt, BackedgeTarget target)
 {
@@ -486,12 +528,14 @@ jit::FinishOffThreadBuilder(JSContext* cx, IonBuilder* builder)
                                             : nullptr);
     }
 
-    // The builder is allocated into its LifoAlloc, so destroying that will
+    // The builder is allocated into its LifoAlloc, so releasing that will
     // destroy the builder and all other data accumulated during compilation,
     // except any final codegen (which includes an assembler and needs to be
-    // explicitly destroyed).
+    // explicitly destroyed). The LifoAlloc's chunks are kept around for the
+    // next compilation.
+    JitRuntime* jitRuntime = builder->script()->runtimeFromMainThread()->jitRuntime();
     js_delete(builder->backgroundCodegen());
-    js_delete(builder->alloc().lifoAlloc());
+    jitRuntime->recycleIonLifoAlloc(builder->alloc().lifoAlloc());
 }
 
 static inline void
@@ -1648,6 +1692,10 @@ GenerateLIR(MIRGenerator* mir)
 
         IonRegisterAllocator allocator = mir->optimizationInfo().registerAllocator();
 
+#ifdef JS_JITSPEW
+        int64_t regallocStart = PRMJ_Now();
+#endif
+
         switch (allocator) {
           case RegisterAllocator_Backtracking:
           case RegisterAllocator_Testbed: {
@@ -1689,6 +1737,16 @@ GenerateLIR(MIRGenerator* mir)
             MOZ_CRASH("Bad regalloc");
         }
 
+#ifdef JS_JITSPEW
+        // Register allocation dominates compile time for very large
+        // functions, so report how long it took relative to the LIR size.
+        JitSpew(JitSpew_RegAlloc,
+                "%s allocator: %u instructions, %u vregs, %.3f ms",
+                allocator == RegisterAllocator_Stupid ? "Stupid" : "Backtracking",
+                lir->numInstructions(), lir->numVirtualRegisters(),
+                double(PRMJ_Now() - regallocStart) / PRMJ_USEC_PER_MSEC);
+#endif
+
         if (mir->shouldCancel("Allocate Registers"))
             return nullptr;
     }
@@ -1926,7 +1984,7 @@ IonCompile(JSContext* cx, JSScript* script,
 
     TrackPropertiesForSingletonScopes(cx, script, baselineFrame);
 
-    LifoAlloc* alloc = cx->new_<LifoAlloc>(TempAllocator::PreferredLifoChunkSize);
+    LifoAlloc* alloc = cx->runtime()->jitRuntime()->newIonLifoAlloc(cx);
     if (!alloc)
         return AbortReason_Alloc;
 
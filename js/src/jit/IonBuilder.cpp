@@ -5078,24 +5078,44 @@ IonBuilder::selectInliningTargets(const ObjectVector& targets, CallInfo& callInf
             MOZ_CRASH("Unhandled InliningDecision value!");
         }
 
-        if (target->is<JSFunction>()) {
-            // Enforce a maximum inlined bytecode limit at the callsite.
-            if (inlineable && target->as<JSFunction>().isInterpreted()) {
-                totalSize += target->as<JSFunction>().nonLazyScript()->length();
-                bool offThread = options.offThreadCompilationAvailable();
-                if (totalSize > optimizationInfo().inlineMaxBytecodePerCallSite(offThread))
-                    inlineable = false;
-            }
-        } else {
-            // Non-function targets are not supported by polymorphic inlining.
+        // Non-function targets are not supported by polymorphic inlining.
+        if (!target->is<JSFunction>())
             inlineable = false;
-        }
 
-        choiceSet.append(inlineable);
+        choiceSet.infallibleAppend(inlineable);
         if (inlineable)
             *numInlineable += 1;
     }
 
+    // Enforce a maximum inlined bytecode limit at the callsite. If there are
+    // several scripted targets, spend this budget on the hottest ones first,
+    // using their warm-up counts as a profile of how often each one runs.
+    Vector<JSScript*, 4, JitAllocPolicy> scripts(alloc());
+    Vector<size_t, 4, JitAllocPolicy> order(alloc());
+    for (size_t i = 0; i < targets.length(); i++) {
+        if (!choiceSet[i] || !targets[i]->as<JSFunction>().isInterpreted())
+            continue;
+        JSScript* calleeScript = targets[i]->as<JSFunction>().nonLazyScript();
+        size_t j = order.length();
+        if (!order.append(i) || !scripts.append(calleeScript))
+            return false;
+        for (; j > 0 && scripts[j - 1]->getWarmUpCount() < calleeScript->getWarmUpCount(); j--) {
+            order[j] = order[j - 1];
+            scripts[j] = scripts[j - 1];
+        }
+        order[j] = i;
+        scripts[j] = calleeScript;
+    }
+
+    bool offThread = options.offThreadCompilationAvailable();
+    for (size_t i = 0; i < order.length(); i++) {
+        totalSize += scripts[i]->length();
+        if (totalSize > optimizationInfo().inlineMaxBytecodePerCallSite(offThread)) {
+            choiceSet[order[i]] = false;
+            *numInlineable -= 1;
+        }
+    }
+
     // If optimization tracking is turned on and one of the inlineable targets
     // is a native, track the type info of the call. Most native inlinings
     // depend on the types of the arguments and the return value.
@@ -6552,8 +6572,11 @@ IonBuilder::jsop_newarray_copyonwrite()
     MOZ_ASSERT_IF(info().analysisMode() != Analysis_ArgumentsUsage,
                   templateObject->group()->hasAnyFlags(OBJECT_FLAG_COPY_ON_WRITE));
 
+    MConstant* templateConst = MConstant::NewConstraintlessObject(alloc(), templateObject);
+    current->add(templateConst);
+
     MNewArrayCopyOnWrite* ins =
-        MNewArrayCopyOnWrite::New(alloc(), constraints(), templateObject,
+        MNewArrayCopyOnWrite::New(alloc(), constraints(), templateConst,
                                   templateObject->group()->initialHeap(constraints()));
 
     current->add(ins);
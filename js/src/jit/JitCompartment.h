@@ -199,6 +199,12 @@ class JitRuntime
     typedef WeakCache<const VMFunction*, JitCode*> VMWrapperMap;
     VMWrapperMap* functionWrappers_;
 
+    // LifoAllocs of finished off thread Ion compilations, whose chunks are
+    // reused by later compilations instead of being returned to malloc after
+    // every compile. Only accessed on the main thread, and emptied on GC.
+    static const size_t MaxCachedIonLifoAllocs = 4;
+    Vector<LifoAlloc*, MaxCachedIonLifoAllocs, SystemAllocPolicy> ionLifoAllocCache_;
+
     // Buffer for OSR from baseline to Ion. To avoid holding on to this for
     // too long, it's also freed in JitCompartment::mark and in EnterBaseline
     // (after returning from JIT code).
@@ -253,6 +259,13 @@ class JitRuntime
     uint8_t* allocateOsrTempData(size_t size);
     void freeOsrTempData();
 
+    // Get a LifoAlloc for a new Ion compilation, recycling a cached one if
+    // possible, and take it back once the compilation has been finished.
+    LifoAlloc* newIonLifoAlloc(JSContext* cx);
+    void recycleIonLifoAlloc(LifoAlloc* alloc);
+    void purgeIonLifoAllocCache();
+    size_t sizeOfIonLifoAllocCache(mozilla::MallocSizeOf mallocSizeOf) const;
+
     static void Mark(JSTracer* trc);
     static bool MarkJitcodeGlobalTableIteratively(JSTracer* trc);
     static void SweepJitcodeGlobalTable(JSRuntime* rt);
@@ -408,6 +421,12 @@ class JitCompartment
     friend class JitActivation;
 
     // Map ICStub keys to ICStub shared code objects.
+    //
+    // Stub code is shared by all the stubs of a compartment which produce
+    // the same key, with per-stub data such as shapes and slot offsets read
+    // from the ICStub itself. The code cannot be shared across compartments
+    // as some stubs bake in compartment-specific addresses, such as the
+    // metadata callback or the neutered typed objects flag.
     typedef WeakValueCache<uint32_t, ReadBarrieredJitCode> ICStubCodeMap;
     ICStubCodeMap* stubCodes_;
 
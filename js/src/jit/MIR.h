@@ -2956,19 +2956,20 @@ class MNewArray
     }
 };
 
-class MNewArrayCopyOnWrite : public MNullaryInstruction
+class MNewArrayCopyOnWrite
+  : public MUnaryInstruction,
+    public NoTypePolicy::Data
 {
-    CompilerGCPointer<ArrayObject*> templateObject_;
     gc::InitialHeap initialHeap_;
 
-    MNewArrayCopyOnWrite(CompilerConstraintList* constraints, ArrayObject* templateObject,
-              gc::InitialHeap initialHeap)
-      : templateObject_(templateObject),
+    MNewArrayCopyOnWrite(CompilerConstraintList* constraints, MConstant* templateConst,
+                         gc::InitialHeap initialHeap)
+      : MUnaryInstruction(templateConst),
         initialHeap_(initialHeap)
     {
-        MOZ_ASSERT(!templateObject->isSingleton());
+        MOZ_ASSERT(!templateObject()->isSingleton());
         setResultType(MIRType_Object);
-        setResultTypeSet(MakeSingletonTypeSet(constraints, templateObject));
+        setResultTypeSet(MakeSingletonTypeSet(constraints, templateObject()));
     }
 
   public:
@@ -2976,14 +2977,14 @@ class MNewArrayCopyOnWrite : public MNullaryInstruction
 
     static MNewArrayCopyOnWrite* New(TempAllocator& alloc,
                                      CompilerConstraintList* constraints,
-                                     ArrayObject* templateObject,
+                                     MConstant* templateConst,
                                      gc::InitialHeap initialHeap)
     {
-        return new(alloc) MNewArrayCopyOnWrite(constraints, templateObject, initialHeap);
+        return new(alloc) MNewArrayCopyOnWrite(constraints, templateConst, initialHeap);
     }
 
     ArrayObject* templateObject() const {
-        return templateObject_;
+        return &getOperand(0)->toConstant()->value().toObject().as<ArrayObject>();
     }
 
     gc::InitialHeap initialHeap() const {
@@ -2993,6 +2994,13 @@ class MNewArrayCopyOnWrite : public MNullaryInstruction
     virtual AliasSet getAliasSet() const override {
         return AliasSet::None();
     }
+
+    bool writeRecoverData(CompactBufferWriter& writer) const override;
+    bool canRecoverOnBailout() const override {
+        // The elements of the template object are shared copy-on-write and
+        // are never mutated, so a bailout can allocate an identical array.
+        return true;
+    }
 };
 
 class MNewArrayDynamicLength
@@ -98,6 +98,7 @@ namespace jit {
     _(TruncateToInt32)                          \
     _(NewObject)                                \
     _(NewArray)                                 \
+    _(NewArrayCopyOnWrite)                      \
     _(NewDerivedTypedObject)                    \
     _(CreateThisWithTemplate)                   \
     _(Lambda)                                   \
@@ -684,6 +685,21 @@ class RNewArray final : public RInstruction
     bool recover(JSContext* cx, SnapshotIterator& iter) const;
 };
 
+class RNewArrayCopyOnWrite final : public RInstruction
+{
+  private:
+    gc::InitialHeap initialHeap_;
+
+  public:
+    RINSTRUCTION_HEADER_(NewArrayCopyOnWrite)
+
+    virtual uint32_t numOperands() const {
+        return 1;
+    }
+
+    bool recover(JSContext* cx, SnapshotIterator& iter) const;
+};
+
 class RNewDerivedTypedObject final : public RInstruction
 {
   public:
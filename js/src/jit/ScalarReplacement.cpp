@@ -1247,6 +1247,143 @@ ArrayMemoryView::visitArrayLength(MArrayLength* ins)
     discardInstruction(ins, elements);
 }
 
+// Returns False if the copy-on-write array is only read with known constant
+// indexes, in which case all its reads can be folded to the content of the
+// template object.
+static bool
+IsCopyOnWriteArrayEscaped(MNewArrayCopyOnWrite* ins)
+{
+    JitSpewDef(JitSpew_Escape, "Check copy-on-write array\n", ins);
+    JitSpewIndent spewIndent(JitSpew_Escape);
+
+    ArrayObject* templateObject = ins->templateObject();
+    uint32_t initLength = templateObject->getDenseInitializedLength();
+    if (initLength != templateObject->length()) {
+        JitSpew(JitSpew_Escape, "Template object has a non-initialized tail");
+        return true;
+    }
+
+    for (MUseIterator i(ins->usesBegin()); i != ins->usesEnd(); i++) {
+        MNode* consumer = (*i)->consumer();
+        if (!consumer->isDefinition()) {
+            // Cannot optimize if it is observable from fun.arguments or others.
+            if (!consumer->toResumePoint()->isRecoverableOperand(*i)) {
+                JitSpew(JitSpew_Escape, "Observable array cannot be recovered");
+                return true;
+            }
+            continue;
+        }
+
+        MDefinition* def = consumer->toDefinition();
+        switch (def->op()) {
+          case MDefinition::Op_Elements:
+            break;
+
+          // This instruction is a no-op used to verify that scalar replacement
+          // is working as expected in jit-test.
+          case MDefinition::Op_AssertRecoveredOnBailout:
+            continue;
+
+          default:
+            JitSpewDef(JitSpew_Escape, "is escaped by\n", def);
+            return true;
+        }
+
+        // Any write would first go through MMaybeCopyElementsForWrite, which
+        // escapes the array, so only the reads have to be checked.
+        MElements* elements = def->toElements();
+        for (MUseIterator j(elements->usesBegin()); j != elements->usesEnd(); j++) {
+            MDefinition* access = (*j)->consumer()->toDefinition();
+            switch (access->op()) {
+              case MDefinition::Op_LoadElement: {
+                MLoadElement* load = access->toLoadElement();
+                if (load->loadDoubles() || load->offsetAdjustment() != 0) {
+                    JitSpewDef(JitSpew_Escape, "has a non-trivial load element\n", access);
+                    return true;
+                }
+
+                int32_t index;
+                if (!IndexOf(access, &index)) {
+                    JitSpewDef(JitSpew_Escape,
+                               "has a load element with a non-trivial index\n", access);
+                    return true;
+                }
+                if (index < 0 || initLength <= uint32_t(index)) {
+                    JitSpewDef(JitSpew_Escape,
+                               "has a load element with an out-of-bound index\n", access);
+                    return true;
+                }
+
+                // Copy-on-write arrays are only created for array literals of
+                // primitive values, but do not rely on it when folding.
+                const Value& val = templateObject->getDenseElement(index);
+                if (val.isMagic() || val.isObject()) {
+                    JitSpewDef(JitSpew_Escape,
+                               "has a load element of a non-primitive value\n", access);
+                    return true;
+                }
+                break;
+              }
+
+              case MDefinition::Op_InitializedLength:
+              case MDefinition::Op_ArrayLength:
+                break;
+
+              default:
+                JitSpewDef(JitSpew_Escape, "is escaped by\n", access);
+                return true;
+            }
+        }
+    }
+
+    JitSpew(JitSpew_Escape, "Copy-on-write array is not escaped");
+    return false;
+}
+
+// The elements of a copy-on-write array are never mutated, so there is no
+// state to emulate across blocks: every read is replaced by the constant taken
+// from the template object, and the allocation is only kept for resume points,
+// where it is recovered on bailout.
+static void
+ReplaceCopyOnWriteArray(TempAllocator& alloc, MNewArrayCopyOnWrite* arr)
+{
+    ArrayObject* templateObject = arr->templateObject();
+
+    MConstant* length = MConstant::New(alloc, Int32Value(templateObject->length()));
+    arr->block()->insertBefore(arr, length);
+
+    for (MUseIterator i(arr->usesBegin()); i != arr->usesEnd(); ) {
+        MNode* consumer = (*i++)->consumer();
+        if (!consumer->isDefinition() || !consumer->toDefinition()->isElements())
+            continue;
+
+        MElements* elements = consumer->toDefinition()->toElements();
+        for (MUseIterator j(elements->usesBegin()); j != elements->usesEnd(); ) {
+            MInstruction* access = (*j++)->consumer()->toDefinition()->toInstruction();
+
+            MDefinition* replacement = length;
+            if (access->isLoadElement()) {
+                int32_t index;
+                MOZ_ALWAYS_TRUE(IndexOf(access, &index));
+                MConstant* val = MConstant::New(alloc, templateObject->getDenseElement(index));
+                access->block()->insertBefore(access, val);
+                replacement = val;
+            }
+
+            access->replaceAllUsesWith(replacement);
+            access->block()->discard(access);
+        }
+
+        elements->block()->discard(elements);
+    }
+
+    // Annotate the instruction such that we do not replace it by a
+    // Magic(JS_OPTIMIZED_OUT) in case of removed uses.
+    arr->setImplicitlyUsedUnchecked();
+    arr->setRecoveredOnBailout();
+    MOZ_ASSERT(!arr->hasLiveDefUses());
+}
+
 bool
 ScalarReplacement(MIRGenerator* mir, MIRGraph& graph)
 {
@@ -1278,6 +1415,13 @@ ScalarReplacement(MIRGenerator* mir, MIRGraph& graph)
                 addedPhi = true;
                 continue;
             }
+
+            if (ins->isNewArrayCopyOnWrite() &&
+                !IsCopyOnWriteArrayEscaped(ins->toNewArrayCopyOnWrite()))
+            {
+                ReplaceCopyOnWriteArray(graph.alloc(), ins->toNewArrayCopyOnWrite());
+                continue;
+            }
         }
     }
 
@@ -415,6 +415,11 @@ ICStub::trace(JSTracer* trc)
         TraceEdge(trc, &propStub->name(), "baseline-getproplistbaseshadowed-stub-name");
         break;
       }
+      case ICStub::GetProp_GenericProxy: {
+        ICGetProp_GenericProxy* propStub = toGetProp_GenericProxy();
+        TraceEdge(trc, &propStub->name(), "baseline-getpropgenericproxy-stub-name");
+        break;
+      }
       case ICStub::GetProp_CallScripted: {
         ICGetProp_CallScripted* callStub = toGetProp_CallScripted();
         callStub->receiverGuard().trace(trc);
@@ -700,6 +700,7 @@ class ICStub
           case GetProp_CallDOMProxyNative:
           case GetProp_CallDOMProxyWithGenerationNative:
           case GetProp_DOMProxyShadowed:
+          case GetProp_GenericProxy:
           case GetProp_Generic:
           case SetProp_CallScripted:
           case SetProp_CallNative:
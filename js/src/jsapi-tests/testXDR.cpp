@@ -157,3 +157,38 @@ BEGIN_TEST(testXDR_sourceMap)
     return true;
 }
 END_TEST(testXDR_sourceMap)
+
+BEGIN_TEST(testXDR_relazifiedInnerFunction)
+{
+    JS::RootedScript script(cx);
+    JS::CompileOptions options(cx);
+    options.setFileAndLine(__FILE__, __LINE__);
+    const char s[] = "function f(x) { return x + 1; }\n"
+                     "f(1);\n";
+    CHECK(JS_CompileScript(cx, s, strlen(s), options, &script));
+    CHECK(script);
+
+    // Run the script so that |f| is compiled before it is encoded.
+    JS::RootedValue v(cx);
+    CHECK(JS_ExecuteScript(cx, script, &v));
+
+    script = FreezeThaw(cx, script);
+    CHECK(script);
+    CHECK(script->hasObjects());
+
+    // |f| still has its LazyScript, so it is decoded without bytecode.
+    JS::RootedFunction fun(cx);
+    for (size_t i = 0; i < script->objects()->length; i++) {
+        JSObject* obj = script->getObject(i);
+        if (obj->is<JSFunction>())
+            fun = &obj->as<JSFunction>();
+    }
+    CHECK(fun);
+    CHECK(fun->isInterpretedLazy());
+
+    CHECK(JS_ExecuteScript(cx, script, &v));
+    EVAL("f(41)", &v);
+    CHECK_SAME(v, JS::Int32Value(42));
+    return true;
+}
+END_TEST(testXDR_relazifiedInnerFunction)
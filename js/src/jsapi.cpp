@@ -5287,6 +5287,14 @@ JS_ParseJSON(JSContext* cx, const char16_t* chars, uint32_t len, MutableHandleVa
     return ParseJSONWithReviver(cx, mozilla::Range<const char16_t>(chars, len), NullHandleValue, vp);
 }
 
+JS_PUBLIC_API(bool)
+JS_ParseJSON(JSContext* cx, const Latin1Char* chars, uint32_t len, MutableHandleValue vp)
+{
+    AssertHeapIsIdle(cx);
+    CHECK_REQUEST(cx);
+    return ParseJSONWithReviver(cx, mozilla::Range<const Latin1Char>(chars, len), NullHandleValue, vp);
+}
+
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, HandleString str, MutableHandleValue vp)
 {
@@ -4467,6 +4467,13 @@ JS_Stringify(JSContext* cx, JS::MutableHandleValue value, JS::HandleObject repla
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, const char16_t* chars, uint32_t len, JS::MutableHandleValue vp);
 
+/*
+ * Like the above, but for Latin1 input. Callers holding ASCII or Latin1 data
+ * can use this to avoid inflating it to UTF-16 before parsing.
+ */
+JS_PUBLIC_API(bool)
+JS_ParseJSON(JSContext* cx, const JS::Latin1Char* chars, uint32_t len, JS::MutableHandleValue vp);
+
 JS_PUBLIC_API(bool)
 JS_ParseJSON(JSContext* cx, JS::HandleString str, JS::MutableHandleValue vp);
 
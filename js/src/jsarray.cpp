@@ -1810,6 +1810,63 @@ SortNumerically(JSContext* cx, AutoValueVector* vec, size_t len, ComparatorMatch
                           SortComparatorNumerics[comp], vec);
 }
 
+/*
+ * Below this many elements MergeSort beats the fixed cost of the radix sort's
+ * counting passes.
+ */
+static const size_t MinRadixSortLength = 256;
+
+/*
+ * Sort int32 Values numerically with an LSD radix sort.
+ *
+ * Unlike the MergeSort paths this is not stable, but equal int32 Values are
+ * indistinguishable so that does not matter.
+ */
+static bool
+SortInt32sNumerically(JSContext* cx, AutoValueVector* vec, size_t len,
+                      ComparatorMatchResult comp)
+{
+    MOZ_ASSERT(vec->length() >= len);
+
+    /* The upper half is the destination of each pass. */
+    Vector<uint32_t, 0, TempAllocPolicy> keys(cx);
+    if (!keys.resize(2 * len))
+        return false;
+
+    /* Flip the sign bit so that unsigned order matches int32 order. */
+    uint32_t* src = keys.begin();
+    uint32_t* dst = keys.begin() + len;
+    for (size_t i = 0; i < len; i++)
+        src[i] = uint32_t((*vec)[i].toInt32()) ^ 0x80000000;
+
+    for (unsigned shift = 0; shift < 32; shift += 8) {
+        size_t counts[256] = {};
+        for (size_t i = 0; i < len; i++)
+            counts[(src[i] >> shift) & 0xff]++;
+
+        /* Skip passes over a byte that is the same in every key. */
+        if (counts[(src[0] >> shift) & 0xff] == len)
+            continue;
+
+        size_t offset = 0;
+        for (size_t d = 0; d < 256; d++) {
+            size_t count = counts[d];
+            counts[d] = offset;
+            offset += count;
+        }
+        for (size_t i = 0; i < len; i++)
+            dst[counts[(src[i] >> shift) & 0xff]++] = src[i];
+        std::swap(src, dst);
+    }
+
+    for (size_t i = 0; i < len; i++) {
+        size_t index = comp == Match_LeftMinusRight ? i : len - 1 - i;
+        (*vec)[index].setInt32(int32_t(src[i] ^ 0x80000000));
+    }
+
+    return true;
+}
+
 bool
 js::array_sort(JSContext* cx, unsigned argc, Value* vp)
 {
@@ -1937,7 +1994,10 @@ js::array_sort(JSContext* cx, unsigned argc, Value* vp)
                 return false;
 
             if (comp != Match_None) {
-                if (allInts) {
+                if (allInts && n >= MinRadixSortLength) {
+                    if (!SortInt32sNumerically(cx, &vec, n, comp))
+                        return false;
+                } else if (allInts) {
                     JS_ALWAYS_TRUE(vec.resize(n * 2));
                     if (!MergeSort(vec.begin(), n, vec.begin() + n, SortComparatorInt32s[comp]))
                         return false;
@@ -312,6 +312,15 @@ AtomIsPinned(JSContext* cx, JSAtom* atom)
     return p->isPinned();
 }
 
+// Adds |atom| to a zone's atom cache unless the cache is full. A failure to
+// cache the atom is harmless.
+static void
+CacheAtomInZone(AtomSet& cache, JSAtom* atom)
+{
+    if (cache.count() < Zone::AtomCacheMaxEntries)
+        (void) cache.put(AtomStateEntry(atom, false));
+}
+
 /* |tbchars| must not point into an inline or short string. */
 template <typename CharT>
 MOZ_ALWAYS_INLINE
@@ -334,6 +343,15 @@ AtomizeAndCopyChars(ExclusiveContext* cx, const CharT* tbchars, size_t length, P
             return pp->asPtr();
     }
 
+    // Pinning has to update the entry in the runtime's table, so only
+    // unpinned lookups can be satisfied from the zone's cache.
+    AtomSet* zoneCache = pin == DoNotPinAtom ? cx->zoneAtomCache() : nullptr;
+    if (zoneCache) {
+        AtomSet::Ptr zp = zoneCache->lookup(lookup);
+        if (zp)
+            return zp->asPtr();
+    }
+
     AutoLockForExclusiveAccess lock(cx);
 
     AtomSet& atoms = cx->atoms();
@@ -341,6 +359,8 @@ AtomizeAndCopyChars(ExclusiveContext* cx, const CharT* tbchars, size_t length, P
     if (p) {
         JSAtom* atom = p->asPtr();
         p->setPinned(bool(pin));
+        if (zoneCache)
+            CacheAtomInZone(*zoneCache, atom);
         return atom;
     }
 
@@ -365,6 +385,9 @@ AtomizeAndCopyChars(ExclusiveContext* cx, const CharT* tbchars, size_t length, P
         return nullptr;
     }
 
+    if (zoneCache)
+        CacheAtomInZone(*zoneCache, atom);
+
     return atom;
 }
 
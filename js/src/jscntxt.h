@@ -252,6 +252,10 @@ class ExclusiveContext : public ContextFriendFields,
     // Zone local methods that can be used freely from an ExclusiveContext.
     inline js::LifoAlloc& typeLifoAlloc();
 
+    // The current zone's cache of atoms, or nullptr if there is no current
+    // zone or it is the atoms zone. See Zone::atomCache().
+    inline js::AtomSet* zoneAtomCache() const;
+
     // Current global. This is only safe to use within the scope of the
     // AutoCompartment from which it's called.
     inline js::Handle<js::GlobalObject*> global() const;
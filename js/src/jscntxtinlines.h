@@ -363,6 +363,16 @@ ExclusiveContext::typeLifoAlloc()
     return zone()->types.typeLifoAlloc;
 }
 
+inline AtomSet*
+ExclusiveContext::zoneAtomCache() const
+{
+    // Use zone_ directly: zone() asserts exclusive access when in the atoms
+    // compartment, and callers use this before taking the lock.
+    if (!zone_ || zone_->isAtomsZone() || !zone_->atomCache().initialized())
+        return nullptr;
+    return &zone_->atomCache();
+}
+
 }  /* namespace js */
 
 inline void
@@ -57,7 +57,7 @@ JSCompartment::JSCompartment(Zone* zone, const JS::CompartmentOptions& options =
     data(nullptr),
     objectMetadataCallback(nullptr),
     lastAnimationTime(0),
-    regExps(runtime_),
+    regExps(),
     globalWriteBarriered(false),
     neuteredTypedObjects(0),
     objectMetadataState(ImmediateMetadata()),
@@ -124,9 +124,6 @@ JSCompartment::init(JSContext* maybecx)
         return false;
     }
 
-    if (!regExps.init(maybecx))
-        return false;
-
     enumerators = NativeIterator::allocateSentinel(maybecx);
     if (!enumerators)
         return false;
@@ -627,11 +624,8 @@ JSCompartment::sweepJitCompartment(FreeOp* fop)
 void
 JSCompartment::sweepRegExps()
 {
-    /*
-     * JIT code increments activeWarmUpCounter for any RegExpShared used by jit
-     * code for the lifetime of the JIT script. Thus, we must perform
-     * sweeping after clearing jit code.
-     */
+    // The RegExpShareds themselves are swept with the zone; only the match
+    // result template object is per compartment.
     regExps.sweep(runtimeFromAnyThread());
 }
 
@@ -770,7 +764,6 @@ JSCompartment::clearTables()
     MOZ_ASSERT(!debugScopes);
     MOZ_ASSERT(!gcWeakMapList);
     MOZ_ASSERT(enumerators->next() == enumerators);
-    MOZ_ASSERT(regExps.empty());
 
     objectGroups.clearTables();
     if (baseShapes.initialized())
@@ -967,7 +960,6 @@ JSCompartment::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
                                       size_t* lazyArrayBuffersArg,
                                       size_t* objectMetadataTablesArg,
                                       size_t* crossCompartmentWrappersArg,
-                                      size_t* regexpCompartment,
                                       size_t* savedStacksSet)
 {
     *compartmentObject += mallocSizeOf(this);
@@ -982,7 +974,6 @@ JSCompartment::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
     if (objectMetadataTable)
         *objectMetadataTablesArg += objectMetadataTable->sizeOfIncludingThis(mallocSizeOf);
     *crossCompartmentWrappersArg += crossCompartmentWrappers.sizeOfExcludingThis(mallocSizeOf);
-    *regexpCompartment += regExps.sizeOfExcludingThis(mallocSizeOf);
     *savedStacksSet += savedStacks_.sizeOfExcludingThis(mallocSizeOf);
 }
 
@@ -513,6 +513,27 @@ fun_resolve(JSContext* cx, HandleObject obj, HandleId id, bool* resolvedp)
     return true;
 }
 
+/*
+ * Whether a function with a non-lazy script can be XDR-encoded using the lazy
+ * script it was compiled from, i.e. whether it could be relazified.
+ */
+static bool
+CanEncodeAsLazy(JSFunction* fun)
+{
+    JSScript* script = fun->nonLazyScript();
+    if (!script->isRelazifiable())
+        return false;
+
+    // Self-hosted scripts are relazifiable without having a lazy script.
+    LazyScript* lazy = script->maybeLazyScript();
+    if (!lazy || lazy->functionNonDelazifying() != fun)
+        return false;
+
+    // Recompiling the function needs its source, which is only encoded if
+    // the ScriptSource has it.
+    return script->scriptSource()->hasSourceData();
+}
+
 template<XDRMode mode>
 bool
 js::XDRInterpretedFunction(XDRState<mode>* xdr, HandleObject enclosingScope, HandleScript enclosingScript,
@@ -556,6 +577,12 @@ js::XDRInterpretedFunction(XDRState<mode>* xdr, HandleObject enclosingScope, Han
             // Encode a lazy script.
             firstword |= IsLazy;
             lazy = fun->lazyScript();
+        } else if (CanEncodeAsLazy(fun)) {
+            // The function was compiled from a lazy script which could still
+            // be used to recompile it. Encode that instead of the bytecode so
+            // decoding doesn't pay for inner functions that are never called.
+            firstword |= IsLazy;
+            lazy = fun->nonLazyScript()->maybeLazyScript();
         } else {
             // Encode the script.
             script = fun->nonLazyScript();
@@ -565,14 +592,19 @@ js::XDRInterpretedFunction(XDRState<mode>* xdr, HandleObject enclosingScope, Han
             firstword |= HasSingletonType;
 
         atom = fun->displayAtom();
-        flagsword = (fun->nargs() << 16) |
-                    (fun->flags() & ~JSFunction::NO_XDR_FLAGS);
+        uint16_t flags = fun->flags() & ~JSFunction::NO_XDR_FLAGS;
+        if ((firstword & IsLazy) && fun->hasScript()) {
+            flags &= ~JSFunction::INTERPRETED;
+            flags |= JSFunction::INTERPRETED_LAZY;
+        }
+        flagsword = (fun->nargs() << 16) | flags;
 
         // The environment of any function which is not reused will always be
         // null, it is later defined when a function is cloned or reused to
         // mirror the scope chain.
         MOZ_ASSERT_IF(fun->isSingleton() &&
-                      !((lazy && lazy->hasBeenCloned()) || (script && script->hasBeenCloned())),
+                      !((lazy && lazy->hasBeenCloned()) ||
+                        (fun->hasScript() && fun->nonLazyScript()->hasBeenCloned())),
                       fun->environment() == nullptr);
     }
 
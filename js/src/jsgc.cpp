@@ -2255,6 +2255,7 @@ GCRuntime::sweepZoneAfterCompacting(Zone* zone)
     zone->discardJitCode(fop);
     sweepTypesAfterCompacting(zone);
     zone->sweepBreakpoints(fop);
+    zone->regExps().sweep(rt);
 
     for (CompartmentsInZoneIter c(zone); !c.done(); c.next()) {
         c->sweepInnerViews();
@@ -2553,7 +2554,19 @@ GCRuntime::updateAllCellPointersParallel(MovingTracer* trc, Zone* zone)
         fgTask.init(rt, &fgArenas, lock);
     }
 
-    fgTask.runFromMainThread(rt);
+    {
+        gcstats::AutoPhase ap(stats, gcstats::PHASE_COMPACT_UPDATE_CELLS);
+        fgTask.runFromMainThread(rt);
+
+        // Arenas that must be updated on the main thread are usually far
+        // fewer than the rest, so once they are done help the helper threads
+        // drain the background list instead of waiting for them.
+        {
+            AutoLockHelperThreadState lock;
+            fgTask.init(rt, &bgArenas, lock);
+        }
+        fgTask.runFromMainThread(rt);
+    }
 
     {
         AutoLockHelperThreadState lock;
@@ -3639,6 +3652,11 @@ GCRuntime::purgeRuntime()
     for (GCCompartmentsIter comp(rt); !comp.done(); comp.next())
         comp->purge();
 
+    // Shrinking GCs are requested on memory pressure, so give back the
+    // caches' storage as well.
+    for (GCZonesIter zone(rt); !zone.done(); zone.next())
+        zone->purgeAtomCache(invocationKind == GC_SHRINK);
+
     freeUnusedLifoBlocksAfterSweeping(&rt->tempLifoAlloc);
 
     rt->interpreterStack().purge(rt);
@@ -3768,6 +3786,37 @@ RelazifyFunctions(Zone* zone, AllocKind kind)
     }
 }
 
+/*
+ * Clears the mark bits of every arena in the zones being collected. This is
+ * started on a helper thread at the beginning of the mark phase so that it
+ * runs concurrently with discarding code, relazification and purging on the
+ * main thread; it is joined before any marking happens.
+ */
+class UnmarkArenasTask : public GCParallelTask
+{
+    /*
+     * GCZonesIter can only be used on the main thread, so the zones to
+     * unmark are collected up front by init().
+     */
+    ZoneVector zones;
+
+    virtual void run() override {
+        for (size_t i = 0; i < zones.length(); i++)
+            zones[i]->arenas.unmarkAll();
+    }
+
+  public:
+    ~UnmarkArenasTask() override { join(); }
+
+    bool init(JSRuntime* rt) {
+        for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
+            if (!zones.append(zone.get()))
+                return false;
+        }
+        return true;
+    }
+};
+
 bool
 GCRuntime::beginMarkPhase(JS::gcreason::Reason reason)
 {
@@ -3852,6 +3901,17 @@ GCRuntime::beginMarkPhase(JS::gcreason::Reason reason)
             zone->arenas.purge();
     }
 
+    /*
+     * Nothing below touches mark bits or arena lists until we join the task
+     * just before marking the roots.
+     */
+    UnmarkArenasTask unmarkTask;
+    bool unmarkStarted = false;
+    if (CanUseExtraThreads() && unmarkTask.init(rt)) {
+        AutoLockHelperThreadState helperLock;
+        unmarkStarted = unmarkTask.startWithLockHeld();
+    }
+
     marker.start();
     GCMarker* gcmarker = &marker;
 
@@ -3896,12 +3956,19 @@ GCRuntime::beginMarkPhase(JS::gcreason::Reason reason)
     gcstats::AutoPhase ap1(stats, gcstats::PHASE_MARK);
 
     {
-        gcstats::AutoPhase ap(stats, gcstats::PHASE_UNMARK);
-
-        for (GCZonesIter zone(rt); !zone.done(); zone.next()) {
-            /* Unmark everything in the zones being collected. */
-            zone->arenas.unmarkAll();
+        /* Unmark everything in the zones being collected. */
+        if (unmarkStarted) {
+            AutoLockHelperThreadState helperLock;
+            joinTask(unmarkTask, gcstats::PHASE_UNMARK);
+        } else {
+            gcstats::AutoPhase ap(stats, gcstats::PHASE_UNMARK);
+            for (GCZonesIter zone(rt); !zone.done(); zone.next())
+                zone->arenas.unmarkAll();
         }
+    }
+
+    {
+        gcstats::AutoPhase ap(stats, gcstats::PHASE_UNMARK);
 
         for (GCCompartmentsIter c(rt); !c.done(); c.next()) {
             /* Unmark all weak maps in the compartments being collected. */
@@ -4829,6 +4896,8 @@ SweepObjectGroupsTask::run()
 /* virtual */ void
 SweepRegExpsTask::run()
 {
+    for (GCZoneGroupIter zone(runtime); !zone.done(); zone.next())
+        zone->regExps().sweep(runtime);
     for (GCCompartmentGroupIter c(runtime); !c.done(); c.next())
         c->sweepRegExps();
 }
@@ -4983,6 +5052,12 @@ GCRuntime::beginSweepingZoneGroup()
     if (sweepingAtoms) {
         AutoLockHelperThreadState helperLock;
         joinTask(sweepAtomsTask, gcstats::PHASE_SWEEP_ATOMS);
+
+        // Atoms may have been cached again since the start of the GC.
+        // Clear those caches as well so that none of them can refer to an
+        // atom that has just been swept.
+        for (GCZonesIter zone(rt); !zone.done(); zone.next())
+            zone->purgeAtomCache();
     }
 
     {
@@ -5336,8 +5411,10 @@ GCRuntime::endSweepPhase(bool destroyingRuntime)
             SweepScriptData(rt);
 
         /* Clear out any small pools that we're hanging on to. */
-        if (jit::JitRuntime* jitRuntime = rt->jitRuntime())
+        if (jit::JitRuntime* jitRuntime = rt->jitRuntime()) {
             jitRuntime->execAlloc().purge();
+            jitRuntime->purgeIonLifoAllocCache();
+        }
 
         /*
          * This removes compartments from rt->compartment, so we do it last to make
@@ -4112,6 +4112,12 @@ LazyScriptHashPolicy::match(JSScript* script, const Lookup& lookup)
         return false;
     }
 
+    // Identical sources are deduplicated by content hash when they are
+    // compressed, so a function loaded from the same file into different
+    // compartments usually matches here without decompressing anything.
+    if (script->scriptSource()->canonicalSource() == lazy->scriptSource()->canonicalSource())
+        return true;
+
     UncompressedSourceCache::AutoHoldEntry holder;
 
     const char16_t* scriptChars = script->scriptSource()->chars(cx, holder);
@@ -727,6 +727,13 @@ class ScriptSource
         return data.parent;
     }
 
+    // Sources whose compressed data turned out to be identical share the
+    // data of a single parent; return that parent, or this source itself.
+    // Two sources with the same canonical source have the same contents.
+    const ScriptSource* canonicalSource() const {
+        return dataType == DataParent ? data.parent : this;
+    }
+
     void setSource(const char16_t* chars, size_t length, bool ownsChars = true);
     void setCompressedSource(JSRuntime* maybert, void* raw, size_t nbytes, HashNumber hash);
     void updateCompressedSourceSet(JSRuntime* rt);
@@ -17,6 +17,10 @@
 
 #include <ctype.h>
 #include <string.h>
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# define JS_INFLATE_CHARS_SSE2
+# include <emmintrin.h>
+#endif
 
 #include "jsapi.h"
 #include "jsarray.h"
@@ -2212,7 +2216,7 @@ class MOZ_STACK_CLASS StringRegExpGuard
         }
         MOZ_ASSERT(pat);
 
-        return cx->compartment()->regExps.get(cx, pat, opt, &re_);
+        return cx->zone()->regExps().get(cx, pat, opt, &re_);
     }
 
     bool zeroLastIndex(JSContext* cx) {
@@ -4579,6 +4583,24 @@ js::InflateString(ExclusiveContext* cx, const char* bytes, size_t* lengthp)
     return nullptr;
 }
 
+void
+js::CopyAndInflateLongChars(char16_t* dst, const Latin1Char* src, size_t srclen)
+{
+    size_t i = 0;
+#ifdef JS_INFLATE_CHARS_SSE2
+    // Interleave each block of 16 Latin1 chars with zero bytes to produce 16
+    // char16_t code units.
+    const __m128i zero = _mm_setzero_si128();
+    for (; i + 16 <= srclen; i += 16) {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_unpacklo_epi8(in, zero));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i + 8), _mm_unpackhi_epi8(in, zero));
+    }
+#endif
+    for (; i < srclen; i++)
+        dst[i] = src[i];
+}
+
 template <typename CharT>
 bool
 js::DeflateStringToBuffer(JSContext* maybecx, const CharT* src, size_t srclen,
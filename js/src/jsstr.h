@@ -276,9 +276,17 @@ CopyAndInflateChars(char16_t* dst, const char* src, size_t srclen)
         dst[i] = (unsigned char) src[i];
 }
 
+/* Out-of-line version of the below, widening 16 chars at a time. */
+extern void
+CopyAndInflateLongChars(char16_t* dst, const JS::Latin1Char* src, size_t srclen);
+
 inline void
 CopyAndInflateChars(char16_t* dst, const JS::Latin1Char* src, size_t srclen)
 {
+    if (srclen >= 32) {
+        CopyAndInflateLongChars(dst, src, srclen);
+        return;
+    }
     for (size_t i = 0; i < srclen; i++)
         dst[i] = src[i];
 }
@@ -405,7 +405,7 @@ CrossCompartmentWrapper::regexp_toShared(JSContext* cx, HandleObject wrapper, Re
 
     // Get an equivalent RegExpShared associated with the current compartment.
     RegExpShared* re = wrapperGuard.re();
-    return cx->compartment()->regExps.get(cx, re->getSource(), re->getFlags(), g);
+    return cx->zone()->regExps().get(cx, re->getSource(), re->getFlags(), g);
 }
 
 bool
@@ -900,14 +900,19 @@ ArrayBufferObject::stealContents(JSContext* cx, Handle<ArrayBufferObject*> buffe
     MOZ_ASSERT_IF(hasStealableContents, buffer->hasStealableContents());
 
     BufferContents oldContents(buffer->dataPointer(), buffer->bufferKind());
-    BufferContents newContents = AllocateArrayBufferContents(cx, buffer->byteLength());
+
+    // When stealing, the neutered buffer only needs a non-null placeholder
+    // since its length drops to zero. Allocating a full-size copy here would
+    // charge large (and in particular mapped) buffers twice against the
+    // malloc trigger on every transfer.
+    uint32_t newByteLength = hasStealableContents ? 1 : buffer->byteLength();
+    BufferContents newContents = AllocateArrayBufferContents(cx, newByteLength);
     if (!newContents)
         return BufferContents::createPlain(nullptr);
 
     if (hasStealableContents) {
         // Return the old contents and give the neutered buffer a pointer to
-        // freshly allocated memory that we will never write to and should
-        // never get committed.
+        // the placeholder, which will never be read or written.
         buffer->setOwnsData(DoesntOwnData);
         if (!ArrayBufferObject::neuter(cx, buffer, newContents)) {
             js_free(newContents.data());
@@ -2045,6 +2045,15 @@ UpdateExecutionObservabilityOfScriptsInZone(JSContext* cx, Zone* zone,
 {
     using namespace js::jit;
 
+    // A single script without a BaselineScript has no JIT code to discard,
+    // and can't have been inlined into any IonScript. Don't evict the
+    // nursery or walk every JIT activation just to find that out; setting a
+    // breakpoint in a script that has only run in the interpreter is common.
+    if (JSScript* script = obs.singleScriptForZoneInvalidation()) {
+        if (!obs.shouldRecompileOrInvalidate(script))
+            return true;
+    }
+
     // See note in js::ReleaseAllJITCode.
     cx->runtime()->gc.evictNursery();
 
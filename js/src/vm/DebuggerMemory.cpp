@@ -307,7 +307,18 @@ DebuggerMemory::setAllocationSamplingProbability(JSContext* cx, unsigned argc, V
         return false;
     }
 
-    memory->getDebugger()->allocationSamplingProbability = probability;
+    Debugger* dbg = memory->getDebugger();
+    if (dbg->allocationSamplingProbability != probability) {
+        dbg->allocationSamplingProbability = probability;
+
+        // Skip counts computed for the old probability could otherwise keep
+        // a debuggee from being sampled at the new rate for a long time.
+        for (WeakGlobalObjectSet::Range r = dbg->allDebuggees(); !r.empty(); r.popFront()) {
+            GlobalObject* global = r.front();
+            global->compartment()->savedStacks().resetAllocationSkipCount(global);
+        }
+    }
+
     args.rval().setUndefined();
     return true;
 }
@@ -726,18 +726,20 @@ GlobalHelperThreadState::pendingIonCompileHasSufficientPriority()
 bool
 GlobalHelperThreadState::canStartParseTask()
 {
-    // Don't allow simultaneous off thread parses, to reduce contention on the
-    // atoms table. Note that asm.js compilation depends on this to avoid
-    // stalling the helper thread, as off thread parse tasks can trigger and
-    // block on other off thread asm.js compilation tasks.
+    // Each parse task has its own zone, so independent scripts can be parsed
+    // concurrently; the atoms table is the only shared state and is guarded
+    // by the exclusive access lock. The number of simultaneous parses is
+    // capped by maxParseThreads() so that asm.js compilation, which parse
+    // tasks can trigger and block on, always has a thread to run on.
     MOZ_ASSERT(isLocked());
     if (parseWorklist().empty())
         return false;
+    size_t parseThreads = 0;
     for (size_t i = 0; i < threadCount; i++) {
         if (threads[i].parseTask)
-            return false;
+            parseThreads++;
     }
-    return true;
+    return parseThreads < maxParseThreads();
 }
 
 bool
@@ -100,6 +100,14 @@ class GlobalHelperThreadState
             return 2;
         return cpuCount;
     }
+    size_t maxParseThreads() const {
+        // A parse task that validates an asm.js module may block waiting for
+        // asm.js compilation tasks to run on other helper threads, so always
+        // leave at least one thread that is not parsing.
+        if (threadCount < 2)
+            return 1;
+        return Min(cpuCount, threadCount - 1);
+    }
 
     GlobalHelperThreadState();
 
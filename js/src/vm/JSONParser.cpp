@@ -56,6 +56,10 @@ JSONParserBase::trace(JSTracer* trc)
             }
         }
     }
+    for (size_t i = 0; i < PropertyNameCacheSize; i++) {
+        if (propertyNameCache[i])
+            TraceRoot(trc, &propertyNameCache[i], "JSONParser property name cache");
+    }
 }
 
 template <typename CharT>
@@ -105,6 +109,27 @@ JSONParserBase::errorReturn()
     return errorHandling == NoError;
 }
 
+template <typename CharT>
+JSAtom*
+JSONParser<CharT>::atomizePropertyName(const CharT* chars, size_t length)
+{
+    size_t hash = length ? (length * 31 + chars[0] * 7 + chars[length - 1]) : 0;
+    JSAtom*& entry = propertyNameCache[hash % PropertyNameCacheSize];
+    if (entry && entry->length() == length) {
+        JS::AutoCheckCannotGC nogc;
+        bool equal = entry->hasLatin1Chars()
+                     ? EqualChars(entry->latin1Chars(nogc), chars, length)
+                     : EqualChars(entry->twoByteChars(nogc), chars, length);
+        if (equal)
+            return entry;
+    }
+
+    JSAtom* atom = AtomizeChars(cx, chars, length);
+    if (atom)
+        entry = atom;
+    return atom;
+}
+
 template <typename CharT>
 template <JSONParserBase::StringType ST>
 JSONParserBase::Token
@@ -133,7 +158,7 @@ JSONParser<CharT>::readString()
             size_t length = current - start;
             current++;
             JSFlatString* str = (ST == JSONParser::PropertyName)
-                                ? AtomizeChars(cx, start.get(), length)
+                                ? atomizePropertyName(start.get(), length)
                                 : NewStringCopyN<CanGC>(cx, start.get(), length);
             if (!str)
                 return token(OOM);
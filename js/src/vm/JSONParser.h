@@ -8,6 +8,7 @@
 #define vm_JSONParser_h
 
 #include "mozilla/Attributes.h"
+#include "mozilla/PodOperations.h"
 #include "mozilla/Range.h"
 
 #include "jspubtd.h"
@@ -103,6 +104,12 @@ class MOZ_STACK_CLASS JSONParserBase : private JS::AutoGCRooter
     Vector<ElementVector*, 5> freeElements;
     Vector<PropertyVector*, 5> freeProperties;
 
+    // Direct-mapped cache of recently atomized property names. Arrays of
+    // records repeat the same keys over and over, so most property names can
+    // be matched here without hashing them and probing the atom table.
+    static const size_t PropertyNameCacheSize = 32;
+    JSAtom* propertyNameCache[PropertyNameCacheSize];
+
 #ifdef DEBUG
     Token lastToken;
 #endif
@@ -117,7 +124,9 @@ class MOZ_STACK_CLASS JSONParserBase : private JS::AutoGCRooter
 #ifdef DEBUG
       , lastToken(Error)
 #endif
-    {}
+    {
+        mozilla::PodArrayZero(propertyNameCache);
+    }
     ~JSONParserBase();
 
     Value numberValue() const {
@@ -215,6 +224,8 @@ class MOZ_STACK_CLASS JSONParser : public JSONParserBase
   private:
     template<StringType ST> Token readString();
 
+    JSAtom* atomizePropertyName(const CharT* chars, size_t length);
+
     Token readNumber();
 
     Token advance();
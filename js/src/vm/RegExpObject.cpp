@@ -316,7 +316,7 @@ RegExpObject::createShared(JSContext* cx, RegExpGuard* g)
     Rooted<RegExpObject*> self(cx, this);
 
     MOZ_ASSERT(!maybeShared());
-    if (!cx->compartment()->regExps.get(cx, getSource(), getFlags(), g))
+    if (!cx->zone()->regExps().get(cx, getSource(), getFlags(), g))
         return false;
 
     self->setShared(**g);
@@ -566,6 +566,9 @@ RegExpShared::trace(JSTracer* trc)
     if (source)
         TraceEdge(trc, &source, "RegExpShared source");
 
+    if (literalPrefix)
+        TraceEdge(trc, &literalPrefix, "RegExpShared literal prefix");
+
     for (size_t i = 0; i < ArrayLength(compilationArray); i++) {
         RegExpCompilation& compilation = compilationArray[i];
         if (compilation.jitCode)
@@ -608,6 +611,63 @@ RegExpShared::compile(JSContext* cx, HandleLinearString input,
     return compile(cx, fakeySource, input, mode, force);
 }
 
+/*
+ * Return the number of leading chars of |chars| that every match of the
+ * pattern must begin with. This is deliberately conservative: any alternation
+ * disqualifies the whole pattern, and a char followed by a quantifier is not
+ * part of the prefix.
+ */
+template <typename CharT>
+static size_t
+LiteralPrefixLength(const CharT* chars, size_t length)
+{
+    for (size_t i = 0; i < length; i++) {
+        if (chars[i] == '|')
+            return 0;
+    }
+
+    size_t i = 0;
+    for (; i < length; i++) {
+        switch (chars[i]) {
+          case '*': case '+': case '?': case '{':
+            return i ? i - 1 : 0;
+          case '^': case '$': case '\\': case '.': case '(': case ')':
+          case '[': case ']': case '}':
+            return i;
+          default:
+            break;
+        }
+    }
+    return i;
+}
+
+bool
+RegExpShared::initLiteralPrefix(JSContext* cx)
+{
+    // Searching for very short prefixes costs more than it saves.
+    static const size_t MinLiteralPrefixLength = 3;
+
+    AutoCheckCannotGC nogc;
+    JSAtom* prefix;
+    if (source->hasLatin1Chars()) {
+        const Latin1Char* chars = source->latin1Chars(nogc);
+        size_t length = LiteralPrefixLength(chars, source->length());
+        if (length < MinLiteralPrefixLength)
+            return true;
+        prefix = AtomizeChars(cx, chars, length);
+    } else {
+        const char16_t* chars = source->twoByteChars(nogc);
+        size_t length = LiteralPrefixLength(chars, source->length());
+        if (length < MinLiteralPrefixLength)
+            return true;
+        prefix = AtomizeChars(cx, chars, length);
+    }
+    if (!prefix)
+        return false;
+    literalPrefix = prefix;
+    return true;
+}
+
 bool
 RegExpShared::compile(JSContext* cx, HandleAtom pattern, HandleLinearString input,
                       CompilationMode mode, ForceByteCodeEnum force)
@@ -615,6 +675,12 @@ RegExpShared::compile(JSContext* cx, HandleAtom pattern, HandleLinearString inpu
     if (!ignoreCase() && !StringHasRegExpMetaChars(pattern))
         canStringMatch = true;
 
+    // Sticky matches are anchored, so there is nothing to search for.
+    if (!canStringMatch && !literalPrefix && !ignoreCase() && !sticky()) {
+        if (!initLiteralPrefix(cx))
+            return false;
+    }
+
     CompileOptions options(cx);
     TokenStream dummyTokenStream(cx, options, nullptr, 0, nullptr);
 
@@ -715,6 +781,16 @@ RegExpShared::execute(JSContext* cx, HandleLinearString input, size_t start,
         return RegExpRunStatus_Success;
     }
 
+    // Skip ahead to the first place a match can possibly start. If the prefix
+    // does not occur at all, there is no need to run the matcher.
+    if (literalPrefix) {
+        MOZ_ASSERT(!sticky());
+        int res = StringFindPattern(input, literalPrefix, start);
+        if (res == -1)
+            return RegExpRunStatus_Success_NotFound;
+        start = res;
+    }
+
     do {
         jit::JitCode* code = compilation(mode, input->hasLatin1Chars()).jitCode;
         if (!code)
@@ -801,15 +877,15 @@ RegExpShared::sizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf)
     return n;
 }
 
-/* RegExpCompartment */
+/* RegExpZone */
 
-RegExpCompartment::RegExpCompartment(JSRuntime* rt)
-  : set_(rt), matchResultTemplateObject_(nullptr)
+RegExpZone::RegExpZone(JSRuntime* rt)
+  : set_(rt)
 {}
 
-RegExpCompartment::~RegExpCompartment()
+RegExpZone::~RegExpZone()
 {
-    // Because of stray mark bits being set (see RegExpCompartment::sweep)
+    // Because of stray mark bits being set (see RegExpZone::sweep)
     // there might still be RegExpShared instances which haven't been deleted.
     if (set_.initialized()) {
         for (Set::Enum e(set_); !e.empty(); e.popFront()) {
@@ -819,88 +895,38 @@ RegExpCompartment::~RegExpCompartment()
     }
 }
 
-ArrayObject*
-RegExpCompartment::createMatchResultTemplateObject(JSContext* cx)
-{
-    MOZ_ASSERT(!matchResultTemplateObject_);
-
-    /* Create template array object */
-    RootedArrayObject templateObject(cx, NewDenseUnallocatedArray(cx, 0, nullptr, TenuredObject));
-    if (!templateObject)
-        return matchResultTemplateObject_; // = nullptr
-
-    // Create a new group for the template.
-    Rooted<TaggedProto> proto(cx, templateObject->getTaggedProto());
-    ObjectGroup* group = ObjectGroupCompartment::makeGroup(cx, templateObject->getClass(), proto);
-    if (!group)
-        return matchResultTemplateObject_; // = nullptr
-    templateObject->setGroup(group);
-
-    /* Set dummy index property */
-    RootedValue index(cx, Int32Value(0));
-    if (!NativeDefineProperty(cx, templateObject, cx->names().index, index, nullptr, nullptr,
-                              JSPROP_ENUMERATE))
-    {
-        return matchResultTemplateObject_; // = nullptr
-    }
-
-    /* Set dummy input property */
-    RootedValue inputVal(cx, StringValue(cx->runtime()->emptyString));
-    if (!NativeDefineProperty(cx, templateObject, cx->names().input, inputVal, nullptr, nullptr,
-                              JSPROP_ENUMERATE))
-    {
-        return matchResultTemplateObject_; // = nullptr
-    }
-
-    // Make sure that the properties are in the right slots.
-    DebugOnly<Shape*> shape = templateObject->lastProperty();
-    MOZ_ASSERT(shape->previous()->slot() == 0 &&
-               shape->previous()->propidRef() == NameToId(cx->names().index));
-    MOZ_ASSERT(shape->slot() == 1 &&
-               shape->propidRef() == NameToId(cx->names().input));
-
-    // Make sure type information reflects the indexed properties which might
-    // be added.
-    AddTypePropertyId(cx, templateObject, JSID_VOID, TypeSet::StringType());
-    AddTypePropertyId(cx, templateObject, JSID_VOID, TypeSet::UndefinedType());
-
-    matchResultTemplateObject_.set(templateObject);
-
-    return matchResultTemplateObject_;
-}
-
 bool
-RegExpCompartment::init(JSContext* cx)
+RegExpZone::init()
 {
-    if (!set_.init(0)) {
-        if (cx)
-            ReportOutOfMemory(cx);
-        return false;
-    }
-
-    return true;
+    return set_.init(0);
 }
 
 void
-RegExpCompartment::sweep(JSRuntime* rt)
+RegExpZone::sweep(JSRuntime* rt)
 {
+    /*
+     * JIT code increments activeWarmUpCounter for any RegExpShared used by jit
+     * code for the lifetime of the JIT script. Thus, we must perform
+     * sweeping after clearing jit code.
+     */
     if (!set_.initialized())
         return;
 
     for (Set::Enum e(set_); !e.empty(); e.popFront()) {
         RegExpShared* shared = e.front();
 
-        // Sometimes RegExpShared instances are marked without the
-        // compartment being subsequently cleared. This can happen if a GC is
-        // restarted while in progress (i.e. performing a full GC in the
-        // middle of an incremental GC) or if a RegExpShared referenced via the
-        // stack is traced but is not in a zone being collected.
+        // Sometimes RegExpShared instances are marked without the zone
+        // being subsequently cleared. This can happen if a GC is restarted
+        // while in progress (i.e. performing a full GC in the middle of an
+        // incremental GC) or if a RegExpShared referenced via the stack is
+        // traced but is not in a zone being collected.
         //
         // Because of this we only treat the marked_ bit as a hint, and destroy
         // the RegExpShared if it was accidentally marked earlier but wasn't
         // marked by the current trace.
         bool keep = shared->marked() &&
-                    IsMarked(&shared->source);
+                    IsMarked(&shared->source) &&
+                    (!shared->literalPrefix || IsMarked(&shared->literalPrefix));
         for (size_t i = 0; i < ArrayLength(shared->compilationArray); i++) {
             RegExpShared::RegExpCompilation& compilation = shared->compilationArray[i];
             if (compilation.jitCode &&
@@ -917,16 +943,10 @@ RegExpCompartment::sweep(JSRuntime* rt)
             e.removeFront();
         }
     }
-
-    if (matchResultTemplateObject_ &&
-        IsAboutToBeFinalized(&matchResultTemplateObject_))
-    {
-        matchResultTemplateObject_.set(nullptr);
-    }
 }
 
 bool
-RegExpCompartment::get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGuard* g)
+RegExpZone::get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGuard* g)
 {
     Key key(source, flags);
     Set::AddPtr p = set_.lookupForAdd(key);
@@ -942,7 +962,6 @@ RegExpCompartment::get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGu
     ScopedJSDeletePtr<RegExpShared> shared(cx->new_<RegExpShared>(source, flags));
     if (!shared)
         return false;
-
     if (!set_.add(p, shared)) {
         ReportOutOfMemory(cx);
         return false;
@@ -956,7 +975,7 @@ RegExpCompartment::get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGu
 }
 
 bool
-RegExpCompartment::get(JSContext* cx, HandleAtom atom, JSString* opt, RegExpGuard* g)
+RegExpZone::get(JSContext* cx, HandleAtom atom, JSString* opt, RegExpGuard* g)
 {
     RegExpFlag flags = RegExpFlag(0);
     if (opt && !ParseRegExpFlags(cx, opt, &flags))
@@ -966,7 +985,7 @@ RegExpCompartment::get(JSContext* cx, HandleAtom atom, JSString* opt, RegExpGuar
 }
 
 size_t
-RegExpCompartment::sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf)
+RegExpZone::sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf)
 {
     size_t n = 0;
     n += set_.sizeOfExcludingThis(mallocSizeOf);
@@ -977,6 +996,72 @@ RegExpCompartment::sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf)
     return n;
 }
 
+/* RegExpCompartment */
+
+RegExpCompartment::RegExpCompartment()
+  : matchResultTemplateObject_(nullptr)
+{}
+
+ArrayObject*
+RegExpCompartment::createMatchResultTemplateObject(JSContext* cx)
+{
+    MOZ_ASSERT(!matchResultTemplateObject_);
+
+    /* Create template array object */
+    RootedArrayObject templateObject(cx, NewDenseUnallocatedArray(cx, 0, nullptr, TenuredObject));
+    if (!templateObject)
+        return matchResultTemplateObject_; // = nullptr
+
+    // Create a new group for the template.
+    Rooted<TaggedProto> proto(cx, templateObject->getTaggedProto());
+    ObjectGroup* group = ObjectGroupCompartment::makeGroup(cx, templateObject->getClass(), proto);
+    if (!group)
+        return matchResultTemplateObject_; // = nullptr
+    templateObject->setGroup(group);
+
+    /* Set dummy index property */
+    RootedValue index(cx, Int32Value(0));
+    if (!NativeDefineProperty(cx, templateObject, cx->names().index, index, nullptr, nullptr,
+                              JSPROP_ENUMERATE))
+    {
+        return matchResultTemplateObject_; // = nullptr
+    }
+
+    /* Set dummy input property */
+    RootedValue inputVal(cx, StringValue(cx->runtime()->emptyString));
+    if (!NativeDefineProperty(cx, templateObject, cx->names().input, inputVal, nullptr, nullptr,
+                              JSPROP_ENUMERATE))
+    {
+        return matchResultTemplateObject_; // = nullptr
+    }
+
+    // Make sure that the properties are in the right slots.
+    DebugOnly<Shape*> shape = templateObject->lastProperty();
+    MOZ_ASSERT(shape->previous()->slot() == 0 &&
+               shape->previous()->propidRef() == NameToId(cx->names().index));
+    MOZ_ASSERT(shape->slot() == 1 &&
+               shape->propidRef() == NameToId(cx->names().input));
+
+    // Make sure type information reflects the indexed properties which might
+    // be added.
+    AddTypePropertyId(cx, templateObject, JSID_VOID, TypeSet::StringType());
+    AddTypePropertyId(cx, templateObject, JSID_VOID, TypeSet::UndefinedType());
+
+    matchResultTemplateObject_.set(templateObject);
+
+    return matchResultTemplateObject_;
+}
+
+void
+RegExpCompartment::sweep(JSRuntime* rt)
+{
+    if (matchResultTemplateObject_ &&
+        IsAboutToBeFinalized(&matchResultTemplateObject_))
+    {
+        matchResultTemplateObject_.set(nullptr);
+    }
+}
+
 /* Functions */
 
 JSObject*
@@ -113,7 +113,7 @@ class RegExpShared
     };
 
   private:
-    friend class RegExpCompartment;
+    friend class RegExpZone;
     friend class RegExpStatics;
 
     typedef frontend::TokenStream TokenStream;
@@ -134,6 +134,12 @@ class RegExpShared
     /* Source to the RegExp, for lazy compilation. */
     RelocatablePtrAtom source;
 
+    /*
+     * Literal text that every match must begin with, if it is long enough to
+     * be worth searching for before running the matcher.
+     */
+    RelocatablePtrAtom literalPrefix;
+
     RegExpFlag         flags;
     size_t             parenCount;
     bool               canStringMatch;
@@ -161,6 +167,8 @@ class RegExpShared
     bool compileIfNecessary(JSContext* cx, HandleLinearString input,
                             CompilationMode mode, ForceByteCodeEnum force);
 
+    bool initLiteralPrefix(JSContext* cx);
+
     const RegExpCompilation& compilation(CompilationMode mode, bool latin1) const {
         return compilationArray[CompilationIndex(mode, latin1)];
     }
@@ -282,7 +290,12 @@ class RegExpGuard : public JS::CustomAutoRooter
     RegExpShared& operator*() { return *re(); }
 };
 
-class RegExpCompartment
+/*
+ * The RegExpShareds used by all compartments in a zone. JIT code is
+ * allocated per zone, so compartments in the same zone (e.g. same-origin
+ * iframes) can share compiled regexps without duplicating any of the work.
+ */
+class RegExpZone
 {
     struct Key {
         JSAtom* atom;
@@ -306,12 +319,31 @@ class RegExpCompartment
     };
 
     /*
-     * The set of all RegExpShareds in the compartment. On every GC, every
+     * The set of all RegExpShareds in the zone. On every GC, every
      * RegExpShared that was not marked is deleted and removed from the set.
      */
     typedef HashSet<RegExpShared*, Key, RuntimeAllocPolicy> Set;
     Set set_;
 
+  public:
+    explicit RegExpZone(JSRuntime* rt);
+    ~RegExpZone();
+
+    bool init();
+    void sweep(JSRuntime* rt);
+
+    bool empty() { return set_.empty(); }
+
+    bool get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGuard* g);
+
+    /* Like 'get', but compile 'maybeOpt' (if non-null). */
+    bool get(JSContext* cx, HandleAtom source, JSString* maybeOpt, RegExpGuard* g);
+
+    size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
+};
+
+class RegExpCompartment
+{
     /*
      * This is the template object where the result of re.exec() is based on,
      * if there is a result. This is used in CreateRegExpMatchResult to set
@@ -322,27 +354,16 @@ class RegExpCompartment
     ArrayObject* createMatchResultTemplateObject(JSContext* cx);
 
   public:
-    explicit RegExpCompartment(JSRuntime* rt);
-    ~RegExpCompartment();
+    RegExpCompartment();
 
-    bool init(JSContext* cx);
     void sweep(JSRuntime* rt);
 
-    bool empty() { return set_.empty(); }
-
-    bool get(JSContext* cx, JSAtom* source, RegExpFlag flags, RegExpGuard* g);
-
-    /* Like 'get', but compile 'maybeOpt' (if non-null). */
-    bool get(JSContext* cx, HandleAtom source, JSString* maybeOpt, RegExpGuard* g);
-
     /* Get or create template object used to base the result of .exec() on. */
     ArrayObject* getOrCreateMatchResultTemplateObject(JSContext* cx) {
         if (matchResultTemplateObject_)
             return matchResultTemplateObject_;
         return createMatchResultTemplateObject(cx);
     }
-
-    size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
 };
 
 class RegExpObject : public NativeObject
@@ -1171,9 +1171,9 @@ SavedStacks::getLocation(JSContext* cx, const FrameIter& iter, MutableHandleLoca
 }
 
 void
-SavedStacks::chooseSamplingProbability(JSContext* cx)
+SavedStacks::chooseSamplingProbability(GlobalObject* global)
 {
-    GlobalObject::DebuggerVector* dbgs = cx->global()->getDebuggers();
+    GlobalObject::DebuggerVector* dbgs = global->getDebuggers();
     if (!dbgs || dbgs->empty())
         return;
 
@@ -1192,24 +1192,14 @@ SavedStacks::chooseSamplingProbability(JSContext* cx)
     }
 }
 
-JSObject*
-SavedStacksMetadataCallback(JSContext* cx, JSObject* target)
+void
+SavedStacks::chooseAllocationSkipCount()
 {
-    RootedObject obj(cx, target);
-
-    SavedStacks& stacks = cx->compartment()->savedStacks();
-    if (stacks.allocationSkipCount > 0) {
-        stacks.allocationSkipCount--;
-        return nullptr;
-    }
-
-    stacks.chooseSamplingProbability(cx);
-    if (stacks.allocationSamplingProbability == 0.0)
-        return nullptr;
-
     // If the sampling probability is set to 1.0, we are always taking a sample
-    // and can therefore leave allocationSkipCount at 0.
-    if (stacks.allocationSamplingProbability != 1.0) {
+    // and can therefore leave allocationSkipCount at 0. With a probability of
+    // 0.0 the count doesn't matter, since nothing gets sampled.
+    allocationSkipCount = 0;
+    if (allocationSamplingProbability != 1.0 && allocationSamplingProbability != 0.0) {
         // Rather than generating a random number on every allocation to decide
         // if we want to sample that particular allocation (which would be
         // expensive), we calculate the number of allocations to skip before
@@ -1227,10 +1217,41 @@ SavedStacksMetadataCallback(JSContext* cx, JSObject* target)
         // until we take the next sample. Any value for X less than (~P)^n
         // yields a skip count greater than n, so the likelihood of a skip count
         // greater than n is (~P)^n, as required.
-        double notSamplingProb = 1.0 - stacks.allocationSamplingProbability;
-        stacks.allocationSkipCount = std::floor(std::log(random_nextDouble(&stacks.rngState)) /
-                                                std::log(notSamplingProb));
+        //
+        // For small P, or when X is (close to) zero, n can exceed the range
+        // of allocationSkipCount, so clamp it rather than overflow.
+        double notSamplingProb = 1.0 - allocationSamplingProbability;
+        double skipCount = std::floor(std::log(random_nextDouble(&rngState)) /
+                                      std::log(notSamplingProb));
+        allocationSkipCount = skipCount < double(UINT32_MAX)
+                              ? uint32_t(skipCount)
+                              : UINT32_MAX;
     }
+}
+
+void
+SavedStacks::resetAllocationSkipCount(GlobalObject* global)
+{
+    chooseSamplingProbability(global);
+    chooseAllocationSkipCount();
+}
+
+JSObject*
+SavedStacksMetadataCallback(JSContext* cx, JSObject* target)
+{
+    RootedObject obj(cx, target);
+
+    SavedStacks& stacks = cx->compartment()->savedStacks();
+    if (stacks.allocationSkipCount > 0) {
+        stacks.allocationSkipCount--;
+        return nullptr;
+    }
+
+    stacks.chooseSamplingProbability(cx->global());
+    if (stacks.allocationSamplingProbability == 0.0)
+        return nullptr;
+
+    stacks.chooseAllocationSkipCount();
 
     RootedSavedFrame frame(cx);
     if (!stacks.saveCurrentStack(cx, &frame))
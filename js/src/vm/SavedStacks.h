@@ -280,6 +280,11 @@ class SavedStacks {
     void     clear();
     void     setRNGState(uint64_t state) { rngState = state; }
 
+    // Redraw the number of allocations left to skip before the next sample
+    // from |global|'s current sampling probability, e.g. because a debugger
+    // changed its probability.
+    void     resetAllocationSkipCount(GlobalObject* global);
+
     size_t sizeOfExcludingThis(mozilla::MallocSizeOf mallocSizeOf);
 
   private:
@@ -317,7 +322,8 @@ class SavedStacks {
                                unsigned maxFrameCount);
     SavedFrame* getOrCreateSavedFrame(JSContext* cx, SavedFrame::HandleLookup lookup);
     SavedFrame* createFrameFromLookup(JSContext* cx, SavedFrame::HandleLookup lookup);
-    void       chooseSamplingProbability(JSContext* cx);
+    void       chooseSamplingProbability(GlobalObject* global);
+    void       chooseAllocationSkipCount();
 
     // Cache for memoizing PCToLineNumber lookups.
 
@@ -1015,10 +1015,29 @@ NewInlineStringDeflated(ExclusiveContext* cx, mozilla::Range<const char16_t> cha
     return str;
 }
 
+/*
+ * Strings of one to three characters are very common in parsed and generated
+ * data, and most of them have a permanent static atom. Handing that out
+ * instead of allocating a new tenured string means nothing is left for the
+ * next major GC to sweep.
+ */
+template <typename CharT>
+static MOZ_ALWAYS_INLINE JSFlatString*
+TryStaticString(ExclusiveContext* cx, const CharT* s, size_t n)
+{
+    if (n > 3)
+        return nullptr;
+
+    return cx->staticStrings().lookup(s, n);
+}
+
 template <AllowGC allowGC>
 static JSFlatString*
 NewStringDeflated(ExclusiveContext* cx, const char16_t* s, size_t n)
 {
+    if (JSFlatString* str = TryStaticString(cx, s, n))
+        return str;
+
     if (JSInlineString::lengthFits<Latin1Char>(n))
         return NewInlineStringDeflated<allowGC>(cx, mozilla::Range<const char16_t>(s, n));
 
@@ -1129,6 +1148,9 @@ template <AllowGC allowGC, typename CharT>
 JSFlatString*
 NewStringCopyNDontDeflate(ExclusiveContext* cx, const CharT* s, size_t n)
 {
+    if (JSFlatString* str = TryStaticString(cx, s, n))
+        return str;
+
     if (JSInlineString::lengthFits<CharT>(n))
         return NewInlineString<allowGC>(cx, mozilla::Range<const CharT>(s, n));
 
@@ -166,7 +166,12 @@ struct SCOutput {
 
   private:
     JSContext* cx;
-    Vector<uint64_t> buf;
+
+    // Small clones (e.g. most postMessage payloads) fit in the inline
+    // storage, so they are written without any intermediate reallocations
+    // and extracted with a single allocation of the exact size.
+    static const size_t InlineWords = 32;
+    Vector<uint64_t, InlineWords> buf;
 };
 
 class SCInput {
@@ -709,8 +714,25 @@ SCOutput::writePtr(const void* p)
 bool
 SCOutput::extractBuffer(uint64_t** datap, size_t* sizep)
 {
-    *sizep = buf.length() * sizeof(uint64_t);
-    return (*datap = buf.extractRawBuffer()) != nullptr;
+    size_t length = buf.length();
+    size_t slack = buf.capacity() - length;
+
+    uint64_t* data = buf.extractRawBuffer();
+    if (!data)
+        return false;
+
+    // The buffer grows to a power of two, so for a large clone (such as one
+    // holding a big typed array) nearly half of it may be unused. Clone
+    // buffers can live for a long time, e.g. while queued for a worker, so
+    // give the slack back to the allocator.
+    if (slack * sizeof(uint64_t) >= 64 * 1024) {
+        if (uint64_t* shrunk = static_cast<uint64_t*>(js_realloc(data, length * sizeof(uint64_t))))
+            data = shrunk;
+    }
+
+    *datap = data;
+    *sizep = length * sizeof(uint64_t);
+    return true;
 }
 
 } /* namespace js */
@@ -8,6 +8,8 @@
 
 #include "mozilla/DebugOnly.h"
 
+#include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "jsapi.h"
@@ -546,7 +548,15 @@ TraceLoggerThread::logTimestamp(uint32_t id)
         return;
 
     MOZ_ASSERT(traceLoggerState);
-    if (!events.ensureSpaceBeforeAdd()) {
+
+    // Once the buffer has reached the maximum size, start over at its beginning
+    // instead of growing it. Consumers notice the skipped events through the
+    // iteration count, see lostEvents().
+    uint32_t maxEvents = traceLoggerState->maxEvents();
+    bool full = !events.hasSpaceForAdd() &&
+                ((maxEvents && events.capacity() >= maxEvents) ||
+                 !events.ensureSpaceBeforeAdd());
+    if (full) {
         uint64_t start = rdtsc() - traceLoggerState->startupTime;
 
         if (graph.get())
@@ -730,6 +740,9 @@ TraceLoggerThreadState::init()
                 "  EnableMainThread        Start logging the main thread immediately.\n"
                 "  EnableOffThread         Start logging helper threads immediately.\n"
                 "  EnableGraph             Enable spewing the tracelogging graph to a file.\n"
+                "  MaxEvents=N             Bound the per-thread event buffers to about N\n"
+                "                          events, reusing them once they are full.\n"
+                "                          N must be between 1 and 4294967295.\n"
             );
             printf("\n");
             exit(0);
@@ -742,6 +755,20 @@ TraceLoggerThreadState::init()
            offThreadEnabled = true;
         if (strstr(options, "EnableGraph"))
            graphSpewingEnabled = true;
+        if (const char* maxEventsOption = strstr(options, "MaxEvents=")) {
+            const char* value = maxEventsOption + strlen("MaxEvents=");
+            char* end;
+            errno = 0;
+            unsigned long long maxEvents = strtoull(value, &end, 10);
+            if (end == value || (*end && *end != ',') || *value == '-' ||
+                errno == ERANGE || maxEvents == 0 || maxEvents > UINT32_MAX)
+            {
+                fprintf(stderr, "TraceLogging: Ignoring invalid MaxEvents value, "
+                                "event buffers are unbounded.\n");
+            } else {
+                maxEvents_ = uint32_t(maxEvents);
+            }
+        }
     }
 
     startupTime = rdtsc();
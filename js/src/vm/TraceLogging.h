@@ -297,6 +297,11 @@ class TraceLoggerThreadState
     bool mainThreadEnabled;
     bool offThreadEnabled;
     bool graphSpewingEnabled;
+
+    // Maximum number of events a thread buffers before starting a new
+    // iteration, or zero if the buffers may grow without bound.
+    uint32_t maxEvents_;
+
     ThreadLoggerHashMap threadLoggers;
     MainThreadLoggers mainThreadLoggers;
 
@@ -312,6 +317,7 @@ class TraceLoggerThreadState
         mainThreadEnabled(false),
         offThreadEnabled(false),
         graphSpewingEnabled(false),
+        maxEvents_(0),
         lock(nullptr)
     { }
 
@@ -330,6 +336,10 @@ class TraceLoggerThreadState
     void enableTextId(JSContext* cx, uint32_t textId);
     void disableTextId(JSContext* cx, uint32_t textId);
 
+    uint32_t maxEvents() const {
+        return maxEvents_;
+    }
+
   private:
     TraceLoggerThread* forMainThread(PerThreadData* mainThread);
     TraceLoggerThread* create();
@@ -31,6 +31,7 @@
 #include "js/MemoryMetrics.h"
 #include "vm/HelperThreads.h"
 #include "vm/Opcodes.h"
+#include "vm/RegExpObject.h"
 #include "vm/Shape.h"
 #include "vm/UnboxedObject.h"
 
@@ -4246,13 +4247,17 @@ TypeScript::destroy()
 void
 Zone::addSizeOfIncludingThis(mozilla::MallocSizeOf mallocSizeOf,
                              size_t* typePool,
-                             size_t* baselineStubsOptimized)
+                             size_t* baselineStubsOptimized,
+                             size_t* regexpZone,
+                             size_t* atomCache)
 {
     *typePool += types.typeLifoAlloc.sizeOfExcludingThis(mallocSizeOf);
     if (jitZone()) {
         *baselineStubsOptimized +=
             jitZone()->optimizedStubSpace()->sizeOfExcludingThis(mallocSizeOf);
     }
+    *regexpZone += regExps().sizeOfExcludingThis(mallocSizeOf);
+    *atomCache += atomCache_.sizeOfExcludingThis(mallocSizeOf);
 }
 
 TypeZone::TypeZone(Zone* zone)
@@ -4300,8 +4305,17 @@ TypeZone::beginSweep(FreeOp* fop, bool releaseTypes, AutoClearTypeInferenceState
                 } else {
                     CompilerOutput newOutput(script);
 
-                    if (!newCompilerOutputs)
+                    // Reserve room for every remaining output up front so
+                    // that sweeping a long list doesn't keep reallocating.
+                    if (!newCompilerOutputs) {
                         newCompilerOutputs = js_new<CompilerOutputVector>();
+                        if (newCompilerOutputs &&
+                            !newCompilerOutputs->reserve(compilerOutputs->length() - i))
+                        {
+                            js_delete(newCompilerOutputs);
+                            newCompilerOutputs = nullptr;
+                        }
+                    }
                     if (newCompilerOutputs && newCompilerOutputs->append(newOutput)) {
                         output.setSweepIndex(newCompilerOutputs->length() - 1);
                     } else {
@@ -141,6 +141,44 @@ class ElementSpecific
     typedef typename SpecificArray::ElementType T;
     typedef typename SpecificArray::SomeTypedArray SomeTypedArray;
 
+#ifdef __arm__
+#  define JS_VOLATILE_ARM volatile // Inhibit unaligned accesses on ARM.
+#  define JS_RESTRICT_UNLESS_ARM /* nothing */
+#else
+#  define JS_VOLATILE_ARM /* nothing */
+#  define JS_RESTRICT_UNLESS_ARM __restrict
+#endif
+
+    /*
+     * Convert |count| elements from |src| into |dest|, one at a time and in
+     * order. Distinct buffers aren't guaranteed to be distinct memory (shared
+     * memory may be mapped by several of them), so the ranges may alias.
+     */
+    template <typename From>
+    static void
+    convertElements(T* dest, JS_VOLATILE_ARM const From* src, uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            dest[i] = T(src[i]);
+    }
+
+    /*
+     * Like convertElements, but |src| must be a private copy that can't
+     * overlap |dest|. Saying so lets the compiler vectorize the loop.
+     */
+    template <typename From>
+    static void
+    convertElementsFromCopy(T* JS_RESTRICT_UNLESS_ARM dest,
+                            JS_VOLATILE_ARM const From* JS_RESTRICT_UNLESS_ARM src,
+                            uint32_t count)
+    {
+        for (uint32_t i = 0; i < count; ++i)
+            dest[i] = T(src[i]);
+    }
+
+#undef JS_RESTRICT_UNLESS_ARM
+#undef JS_VOLATILE_ARM
+
   public:
     /*
      * Copy |source|'s elements into |target|, starting at |target[offset]|.
@@ -172,78 +210,37 @@ class ElementSpecific
             return true;
         }
 
-#ifdef __arm__
-#  define JS_VOLATILE_ARM volatile // Inhibit unaligned accesses on ARM.
-#else
-#  define JS_VOLATILE_ARM /* nothing */
-#endif
-
         void* data = AnyTypedArrayViewData(source);
         switch (AnyTypedArrayType(source)) {
-          case Scalar::Int8: {
-            JS_VOLATILE_ARM
-            int8_t* src = static_cast<int8_t*>(data);
-
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int8:
+            convertElements(dest, static_cast<int8_t*>(data), count);
             break;
-          }
           case Scalar::Uint8:
-          case Scalar::Uint8Clamped: {
-            JS_VOLATILE_ARM
-            uint8_t* src = static_cast<uint8_t*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint8Clamped:
+            convertElements(dest, static_cast<uint8_t*>(data), count);
             break;
-          }
-          case Scalar::Int16: {
-            JS_VOLATILE_ARM
-            int16_t* src = static_cast<int16_t*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int16:
+            convertElements(dest, static_cast<int16_t*>(data), count);
             break;
-          }
-          case Scalar::Uint16: {
-            JS_VOLATILE_ARM
-            uint16_t* src = static_cast<uint16_t*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint16:
+            convertElements(dest, static_cast<uint16_t*>(data), count);
             break;
-          }
-          case Scalar::Int32: {
-            JS_VOLATILE_ARM
-            int32_t* src = static_cast<int32_t*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int32:
+            convertElements(dest, static_cast<int32_t*>(data), count);
             break;
-          }
-          case Scalar::Uint32: {
-            JS_VOLATILE_ARM
-            uint32_t* src = static_cast<uint32_t*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint32:
+            convertElements(dest, static_cast<uint32_t*>(data), count);
             break;
-          }
-          case Scalar::Float32: {
-            JS_VOLATILE_ARM
-            float* src = static_cast<float*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Float32:
+            convertElements(dest, static_cast<float*>(data), count);
             break;
-          }
-          case Scalar::Float64: {
-            JS_VOLATILE_ARM
-            double* src = static_cast<double*>(data);
-            for (uint32_t i = 0; i < count; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Float64:
+            convertElements(dest, static_cast<double*>(data), count);
             break;
-          }
           default:
             MOZ_CRASH("setFromAnyTypedArray with a typed array with bogus type");
         }
 
-#undef JS_VOLATILE_ARM
-
         return true;
     }
 
@@ -337,56 +334,33 @@ class ElementSpecific
                          static_cast<uint8_t*>(source->viewData()),
                          sourceByteLen);
 
+        // The copy doesn't overlap |dest|, so the plain conversion loops apply.
         switch (source->type()) {
-          case Scalar::Int8: {
-            int8_t* src = static_cast<int8_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int8:
+            convertElementsFromCopy(dest, static_cast<int8_t*>(data), len);
             break;
-          }
           case Scalar::Uint8:
-          case Scalar::Uint8Clamped: {
-            uint8_t* src = static_cast<uint8_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint8Clamped:
+            convertElementsFromCopy(dest, static_cast<uint8_t*>(data), len);
             break;
-          }
-          case Scalar::Int16: {
-            int16_t* src = static_cast<int16_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int16:
+            convertElementsFromCopy(dest, static_cast<int16_t*>(data), len);
             break;
-          }
-          case Scalar::Uint16: {
-            uint16_t* src = static_cast<uint16_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint16:
+            convertElementsFromCopy(dest, static_cast<uint16_t*>(data), len);
             break;
-          }
-          case Scalar::Int32: {
-            int32_t* src = static_cast<int32_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Int32:
+            convertElementsFromCopy(dest, static_cast<int32_t*>(data), len);
             break;
-          }
-          case Scalar::Uint32: {
-            uint32_t* src = static_cast<uint32_t*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Uint32:
+            convertElementsFromCopy(dest, static_cast<uint32_t*>(data), len);
             break;
-          }
-          case Scalar::Float32: {
-            float* src = static_cast<float*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Float32:
+            convertElementsFromCopy(dest, static_cast<float*>(data), len);
             break;
-          }
-          case Scalar::Float64: {
-            double* src = static_cast<double*>(data);
-            for (uint32_t i = 0; i < len; ++i)
-                *dest++ = T(*src++);
+          case Scalar::Float64:
+            convertElementsFromCopy(dest, static_cast<double*>(data), len);
             break;
-          }
           default:
             MOZ_CRASH("setFromOverlappingTypedArray with a typed array with bogus type");
         }
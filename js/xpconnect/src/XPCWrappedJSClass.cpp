@@ -133,7 +133,8 @@ nsXPCWrappedJSClass::nsXPCWrappedJSClass(JSContext* cx, REFNSIID aIID,
       mInfo(aInfo),
       mName(nullptr),
       mIID(aIID),
-      mDescriptors(nullptr)
+      mDescriptors(nullptr),
+      mMethodIds(nullptr)
 {
     mRuntime->GetWrappedJSClassMap()->Add(this);
 
@@ -168,6 +169,7 @@ nsXPCWrappedJSClass::~nsXPCWrappedJSClass()
 {
     if (mDescriptors && mDescriptors != &zero_methods_descriptor)
         delete [] mDescriptors;
+    delete [] mMethodIds;
     if (mRuntime)
         mRuntime->GetWrappedJSClassMap()->Remove(this);
 
@@ -175,6 +177,32 @@ nsXPCWrappedJSClass::~nsXPCWrappedJSClass()
         free(mName);
 }
 
+bool
+nsXPCWrappedJSClass::GetMethodId(JSContext* cx, uint16_t methodIndex,
+                                 const char* name, MutableHandleId idp)
+{
+    if (!mMethodIds) {
+        uint16_t methodCount;
+        if (NS_FAILED(mInfo->GetMethodCount(&methodCount)))
+            return false;
+        mMethodIds = new jsid[methodCount];
+        for (uint16_t i = 0; i < methodCount; i++)
+            mMethodIds[i] = JSID_VOID;
+    }
+
+    // Pinned atoms are never collected, so the ids don't need tracing;
+    // XPCNativeMember relies on the same thing.
+    if (JSID_IS_VOID(mMethodIds[methodIndex])) {
+        JSString* str = JS_AtomizeAndPinString(cx, name);
+        if (!str)
+            return false;
+        mMethodIds[methodIndex] = INTERNED_STRING_TO_JSID(cx, str);
+    }
+
+    idp.set(mMethodIds[methodIndex]);
+    return true;
+}
+
 JSObject*
 nsXPCWrappedJSClass::CallQueryInterfaceOnJSObject(JSContext* cx,
                                                   JSObject* jsobjArg,
@@ -988,6 +1016,7 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
     }
 
     RootedValue fval(cx);
+    RootedId methodId(cx);
     RootedObject obj(cx, wrapper->GetJSObject());
     RootedObject thisObj(cx, obj);
 
@@ -1006,6 +1035,9 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
     if (!scriptEval.StartEvaluating(obj))
         goto pre_call_clean_up;
 
+    if (!GetMethodId(cx, methodIndex, name, &methodId))
+        goto pre_call_clean_up;
+
     xpcc->SetException(nullptr);
     XPCJSRuntime::Get()->SetPendingException(nullptr);
 
@@ -1083,7 +1115,7 @@ nsXPCWrappedJSClass::CallMethod(nsXPCWrappedJS* wrapper, uint16_t methodIndex,
                 }
             }
         } else {
-            if (!JS_GetProperty(cx, obj, name, &fval))
+            if (!JS_GetPropertyById(cx, obj, methodId, &fval))
                 goto pre_call_clean_up;
             // XXX We really want to factor out the error reporting better and
             // specifically report the failure to find a function with this name.
@@ -1212,10 +1244,10 @@ pre_call_clean_up:
 
     RootedValue rval(cx);
     if (XPT_MD_IS_GETTER(info->flags)) {
-        success = JS_GetProperty(cx, obj, name, &rval);
+        success = JS_GetPropertyById(cx, obj, methodId, &rval);
     } else if (XPT_MD_IS_SETTER(info->flags)) {
         rval = *argv;
-        success = JS_SetProperty(cx, obj, name, rval);
+        success = JS_SetPropertyById(cx, obj, methodId, rval);
     } else {
         if (!fval.isPrimitive()) {
             AutoSaveContextOptions asco(cx);
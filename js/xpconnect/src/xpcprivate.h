@@ -2411,12 +2411,18 @@ private:
     void CleanupOutparams(JSContext* cx, uint16_t methodIndex, const nsXPTMethodInfo* info,
                           nsXPTCMiniVariant* nativeParams, bool inOutOnly, uint8_t n) const;
 
+    // Returns the pinned id for the method's name, atomizing it on first use
+    // so that calls don't re-atomize the name each time.
+    bool GetMethodId(JSContext* cx, uint16_t methodIndex, const char* name,
+                     JS::MutableHandleId idp);
+
 private:
     XPCJSRuntime* mRuntime;
     nsCOMPtr<nsIInterfaceInfo> mInfo;
     char* mName;
     nsIID mIID;
     uint32_t* mDescriptors;
+    jsid* mMethodIds;
 };
 
 /*************************/
@@ -6,6 +6,7 @@
 #include "FramePropertyTable.h"
 
 #include "mozilla/MemoryReporting.h"
+#include "nsIFrame.h"
 
 namespace mozilla {
 
@@ -20,6 +21,7 @@ FramePropertyTable::Set(nsIFrame* aFrame, const FramePropertyDescriptor* aProper
     mLastFrame = aFrame;
     mLastEntry = mEntries.PutEntry(aFrame);
   }
+  aFrame->AddStateBits(NS_FRAME_HAS_PROPERTIES);
   Entry* entry = mLastEntry;
 
   if (!entry->mProp.IsArray()) {
@@ -70,6 +72,10 @@ FramePropertyTable::Get(const nsIFrame* aFrame,
     *aFoundResult = false;
   }
 
+  if (!(aFrame->GetStateBits() & NS_FRAME_HAS_PROPERTIES)) {
+    return nullptr;
+  }
+
   if (mLastFrame != aFrame) {
     mLastFrame = const_cast<nsIFrame*>(aFrame);
     mLastEntry = mEntries.GetEntry(mLastFrame);
@@ -113,6 +119,10 @@ FramePropertyTable::Remove(nsIFrame* aFrame, const FramePropertyDescriptor* aPro
     *aFoundResult = false;
   }
 
+  if (!(aFrame->GetStateBits() & NS_FRAME_HAS_PROPERTIES)) {
+    return nullptr;
+  }
+
   if (mLastFrame != aFrame) {
     mLastFrame = aFrame;
     mLastEntry = mEntries.GetEntry(aFrame);
@@ -126,6 +136,7 @@ FramePropertyTable::Remove(nsIFrame* aFrame, const FramePropertyDescriptor* aPro
     void* value = entry->mProp.mValue;
     mEntries.RawRemoveEntry(entry);
     mLastEntry = nullptr;
+    aFrame->RemoveStateBits(NS_FRAME_HAS_PROPERTIES);
     if (aFoundResult) {
       *aFoundResult = true;
     }
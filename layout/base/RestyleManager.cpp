@@ -477,7 +477,9 @@ RestyleManager::RecomputePosition(nsIFrame* aFrame)
   nsFrameState savedState = parentFrame->GetStateBits();
   nsHTMLReflowState parentReflowState(aFrame->PresContext(), parentFrame,
                                       &rc, parentSize);
-  parentFrame->RemoveStateBits(~nsFrameState(0));
+  // Constructing the reflow state may have set used margin or padding
+  // properties on the parent, so keep NS_FRAME_HAS_PROPERTIES.
+  parentFrame->RemoveStateBits(~NS_FRAME_HAS_PROPERTIES);
   parentFrame->AddStateBits(savedState);
 
   NS_WARN_IF_FALSE(parentSize.ISize(parentWM) != NS_INTRINSICSIZE &&
@@ -3179,6 +3179,12 @@ nsLayoutUtils::PaintFrame(nsRenderingContext* aRenderingContext, nsIFrame* aFram
     PROFILER_LABEL("nsLayoutUtils", "PaintFrame::BuildDisplayList",
       js::ProfileEntry::Category::GRAPHICS);
 
+    // The display list is rebuilt from scratch on every paint; it lives in
+    // the builder's arena and holds raw frame pointers, so it can't outlive
+    // this call. What we do retain between paints is FrameLayerBuilder's
+    // per-frame layer data, which lets unchanged items skip invalidation and
+    // repainting. Retaining the list itself would need modified-frame
+    // tracking and a merge step before layer building.
     aFrame->BuildDisplayListForStackingContext(&builder, dirtyRect, &list);
   }
   const bool paintAllContinuations = aFlags & PAINT_ALL_CONTINUATIONS;
@@ -147,12 +147,12 @@ nsPresArena::AddSizeOfExcludingThis(mozilla::MallocSizeOf aMallocSizeOf,
   for (auto iter = mFreeLists.Iter(); !iter.Done(); iter.Next()) {
     FreeList* entry = iter.Get();
 
-    // Note that we're not measuring the size of the entries on the free
-    // list here.  The free list knows how many objects we've allocated
-    // ever (which includes any objects that may be on the FreeList's
-    // |mEntries| at this point) and we're using that to determine the
-    // total size of objects allocated with a given ID.
+    // The free list knows how many objects we've allocated ever (which
+    // includes any objects that may be on the FreeList's |mEntries| at
+    // this point).  Objects still on |mEntries| are dead and only waiting
+    // to be reused, so report them separately from the live ones.
     size_t totalSize = entry->mEntrySize * entry->mEntriesEverAllocated;
+    size_t freeSize = entry->mEntrySize * entry->mEntries.Length();
     size_t* p;
 
     switch (NS_PTR_TO_INT32(entry->mKey)) {
@@ -181,7 +181,8 @@ nsPresArena::AddSizeOfExcludingThis(mozilla::MallocSizeOf aMallocSizeOf,
         continue;
     }
 
-    *p += totalSize;
+    *p += totalSize - freeSize;
+    aArenaStats->mFreeListEntries += freeSize;
     totalSizeInFreeLists += totalSize;
   }
 
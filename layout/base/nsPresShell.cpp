@@ -9164,6 +9164,11 @@ PresShell::ProcessReflowCommands(bool aInterruptible)
       AUTO_LAYOUT_PHASE_ENTRY_POINT(GetPresContext(), Reflow);
       nsViewManager::AutoDisableRefresh refreshBlocker(mViewManager);
 
+      // Dirty roots are reflowed one at a time on this thread. Even roots
+      // that are independent formatting contexts share the pres arena, the
+      // frame property table and the font and line-break caches, and
+      // reflowing one can post new dirty roots or destroy frames, so they
+      // can't simply be farmed out to other threads.
       do {
         // Send an incremental reflow notification to the target frame.
         int32_t idx = mDirtyRoots.Length() - 1;
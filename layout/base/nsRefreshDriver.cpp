@@ -1674,6 +1674,7 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
       RunFrameRequestCallbacks(aNowEpoch, aNowTime);
 
       if (mPresContext && mPresContext->GetPresShell()) {
+        TimeStamp styleFlushStart = TimeStamp::Now();
         bool tracingStyleFlush = false;
         nsAutoTArray<nsIPresShell*, 16> observers;
         observers.AppendElements(mStyleFlushObservers);
@@ -1709,6 +1710,10 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
 
         if (tracingStyleFlush) {
           profiler_tracing("Paint", "Styles", TRACING_INTERVAL_END);
+#ifndef ANDROID  /* bug 1142079 */
+          Telemetry::AccumulateTimeDelta(
+            Telemetry::REFRESH_DRIVER_STYLE_FLUSH_TIME, styleFlushStart);
+#endif
         }
 
         if (!nsLayoutUtils::AreAsyncAnimationsEnabled()) {
@@ -1717,6 +1722,7 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
       }
     } else if  (i == 1) {
       // This is the Flush_Layout case.
+      TimeStamp layoutFlushStart = TimeStamp::Now();
       bool tracingLayoutFlush = false;
       nsAutoTArray<nsIPresShell*, 16> observers;
       observers.AppendElements(mLayoutFlushObservers);
@@ -1755,6 +1761,10 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
 
       if (tracingLayoutFlush) {
         profiler_tracing("Paint", "Reflow", TRACING_INTERVAL_END);
+#ifndef ANDROID  /* bug 1142079 */
+        Telemetry::AccumulateTimeDelta(
+          Telemetry::REFRESH_DRIVER_LAYOUT_FLUSH_TIME, layoutFlushStart);
+#endif
       }
     }
 
@@ -1827,8 +1837,13 @@ nsRefreshDriver::Tick(int64_t aNowEpoch, TimeStamp aNowTime)
 #endif
 
     mViewManagerFlushIsPending = false;
+    TimeStamp paintStart = TimeStamp::Now();
     nsRefPtr<nsViewManager> vm = mPresContext->GetPresShell()->GetViewManager();
     vm->ProcessPendingUpdates();
+#ifndef ANDROID  /* bug 1142079 */
+    Telemetry::AccumulateTimeDelta(Telemetry::REFRESH_DRIVER_PAINT_TIME,
+                                   paintStart);
+#endif
 #ifdef MOZ_DUMP_PAINTING
     if (nsLayoutUtils::InvalidationDebuggingIsEnabled()) {
       printf_stderr("Ending ProcessPendingUpdates\n");
@@ -1478,6 +1478,65 @@ nsFlexContainerFrame::
   }
 }
 
+/**
+ * The result of a flex item's last "measuring" reflow, stored on the item's
+ * frame so that a later measurement with the same inputs can skip the reflow
+ * as long as the item hasn't been dirtied in the meantime.
+ *
+ * Flexible items are measured with a forced vertical resize, because their
+ * previous "actual" reflow may have used a different height. That only keeps
+ * the measuring reflow itself from taking incremental shortcuts; its result
+ * still depends only on the inputs below. Percentages in the item's own
+ * height, min-height and max-height resolve against the container's computed
+ * height, which is therefore part of the key, and those of its descendants
+ * resolve against the item's unconstrained height.
+ */
+class CachedMeasuringReflowResult
+{
+public:
+  CachedMeasuringReflowResult(const nsHTMLReflowState& aReflowState,
+                              nscoord aContainerHeight,
+                              nscoord aHeight, nscoord aAscent)
+    : mAvailableSize(aReflowState.AvailableSize())
+    , mComputedWidth(aReflowState.ComputedWidth())
+    , mComputedHeight(aReflowState.ComputedHeight())
+    , mComputedMinHeight(aReflowState.ComputedMinHeight())
+    , mComputedMaxHeight(aReflowState.ComputedMaxHeight())
+    , mContainerHeight(aContainerHeight)
+    , mHeight(aHeight)
+    , mAscent(aAscent)
+  {}
+
+  bool IsValidFor(const nsHTMLReflowState& aReflowState,
+                  nscoord aContainerHeight) const
+  {
+    return mAvailableSize == aReflowState.AvailableSize() &&
+           mComputedWidth == aReflowState.ComputedWidth() &&
+           mComputedHeight == aReflowState.ComputedHeight() &&
+           mComputedMinHeight == aReflowState.ComputedMinHeight() &&
+           mComputedMaxHeight == aReflowState.ComputedMaxHeight() &&
+           mContainerHeight == aContainerHeight;
+  }
+
+  nscoord Height() const { return mHeight; }
+  nscoord Ascent() const { return mAscent; }
+
+private:
+  // Cache key:
+  const LogicalSize mAvailableSize;
+  const nscoord mComputedWidth;
+  const nscoord mComputedHeight;
+  const nscoord mComputedMinHeight;
+  const nscoord mComputedMaxHeight;
+  const nscoord mContainerHeight;
+  // Cached values:
+  const nscoord mHeight;
+  const nscoord mAscent;
+};
+
+NS_DECLARE_FRAME_PROPERTY(CachedFlexMeasuringReflow,
+                          DeleteValue<CachedMeasuringReflowResult>)
+
 nscoord
 nsFlexContainerFrame::
   MeasureFlexItemContentHeight(nsPresContext* aPresContext,
@@ -1505,6 +1564,30 @@ nsFlexContainerFrame::
     childRSForMeasuringHeight.SetVResize(true);
   }
 
+  // If nothing inside the item has changed since we last measured it with
+  // these same constraints, reuse that result rather than reflowing again.
+  FrameProperties props = aFlexItem.Frame()->Properties();
+  if (!NS_SUBTREE_DIRTY(aFlexItem.Frame())) {
+    auto cached = static_cast<CachedMeasuringReflowResult*>(
+      props.Get(CachedFlexMeasuringReflow()));
+    if (cached &&
+        cached->IsValidFor(childRSForMeasuringHeight,
+                           aParentReflowState.ComputedHeight())) {
+      MOZ_LOG(GetFlexContainerLog(), LogLevel::Debug,
+              ("measuring reflow cache hit for flex item %p\n",
+               aFlexItem.Frame()));
+      if (aFlexItem.Frame() == mFrames.FirstChild() ||
+          aFlexItem.GetAlignSelf() == NS_STYLE_ALIGN_ITEMS_BASELINE) {
+        aFlexItem.SetAscent(cached->Ascent());
+      }
+      return cached->Height();
+    }
+  }
+
+  MOZ_LOG(GetFlexContainerLog(), LogLevel::Debug,
+          ("measuring reflow cache miss for flex item %p\n",
+           aFlexItem.Frame()));
+
   nsHTMLReflowMetrics childDesiredSize(childRSForMeasuringHeight);
   nsReflowStatus childReflowStatus;
   const uint32_t flags = NS_FRAME_NO_MOVE_FRAME;
@@ -1534,8 +1617,14 @@ nsFlexContainerFrame::
   // the effective computed value of the "height" property.
   nscoord childDesiredHeight = childDesiredSize.Height() -
     childRSForMeasuringHeight.ComputedPhysicalBorderPadding().TopBottom();
+  childDesiredHeight = std::max(0, childDesiredHeight);
+
+  props.Set(CachedFlexMeasuringReflow(),
+            new CachedMeasuringReflowResult(
+              childRSForMeasuringHeight, aParentReflowState.ComputedHeight(),
+              childDesiredHeight, childDesiredSize.BlockStartAscent()));
 
-  return std::max(0, childDesiredHeight);
+  return childDesiredHeight;
 }
 
 FlexItem::FlexItem(nsHTMLReflowState& aFlexItemReflowState,
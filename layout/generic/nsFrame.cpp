@@ -8582,7 +8582,9 @@ nsFrame::BoxReflow(nsBoxLayoutState&        aState,
       parentReflowState(aPresContext, parentFrame, aRenderingContext,
                         LogicalSize(parentWM, parentSize),
                         nsHTMLReflowState::DUMMY_PARENT_REFLOW_STATE);
-    parentFrame->RemoveStateBits(~nsFrameState(0));
+    // Constructing the reflow state may have set used margin or padding
+    // properties on the parent, so keep NS_FRAME_HAS_PROPERTIES.
+    parentFrame->RemoveStateBits(~NS_FRAME_HAS_PROPERTIES);
     parentFrame->AddStateBits(savedState);
 
     // This may not do very much useful, but it's probably worth trying.
@@ -156,6 +156,19 @@ private:
           return;
         }
       }
+
+      // Attribute names go in under the same all-lowercase restriction as
+      // tags; AncestorFilter::PushAncestor adds the attribute names of each
+      // ancestor.
+      for (nsAttrSelector* attr = sel->mAttrList; attr; attr = attr->mNext) {
+        if (attr->mCasedAttr != attr->mLowercaseAttr) {
+          continue;
+        }
+        mAncestorSelectorHashes[hashIndex++] = attr->mLowercaseAttr->hash();
+        if (hashIndex == eMaxAncestorHashes) {
+          return;
+        }
+      }
     }
 
     while (hashIndex != eMaxAncestorHashes) {
@@ -640,6 +653,13 @@ void ContentEnumFunc(const RuleValue &value, nsCSSSelector* selector,
                      ElementDependentRuleProcessorData* data, NodeMatchContext& nodeContext,
                      AncestorFilter *ancestorFilter);
 
+// Note that matching here is not a pure function of the element and the
+// rules: when styling, SelectorMatches sets NODE_HAS_*_SELECTOR flags on
+// parents, ContentEnumFunc calls StyleRule::RuleMatched and forwards the
+// nsRuleWalker (which allocates rule nodes), and the tree match context is
+// updated as we go. All of that is main-thread state, so running this for
+// several subtrees in parallel would first need those side effects deferred
+// and replayed on the main thread.
 void RuleHash::EnumerateAllRules(Element* aElement, ElementDependentRuleProcessorData* aData,
                                  NodeMatchContext& aNodeContext)
 {
@@ -3853,6 +3873,12 @@ AncestorFilter::PushAncestor(Element *aElement)
       mHashes.AppendElement(classes->AtomAt(i)->hash());
     }
   }
+  // Attribute names, so that selectors like "[data-foo] .bar" can be
+  // rejected without walking up the tree.
+  uint32_t attrCount = aElement->GetAttrCount();
+  for (uint32_t i = 0; i < attrCount; ++i) {
+    mHashes.AppendElement(aElement->GetAttrNameAt(i)->LocalName()->hash());
+  }
 
   uint32_t newLength = mHashes.Length();
   for (uint32_t i = oldLength; i < newLength; ++i) {
@@ -154,6 +154,12 @@ CSSStyleSheet*
 nsLayoutStylesheetCache::QuirkSheet()
 {
   EnsureGlobal();
+
+  if (!gStyleCache->mQuirkSheet) {
+    LoadSheetURL("resource://gre-resources/quirk.css",
+                 gStyleCache->mQuirkSheet, true);
+  }
+
   return gStyleCache->mQuirkSheet;
 }
 
@@ -168,6 +174,12 @@ CSSStyleSheet*
 nsLayoutStylesheetCache::SVGSheet()
 {
   EnsureGlobal();
+
+  if (!gStyleCache->mSVGSheet) {
+    LoadSheetURL("resource://gre/res/svg.css",
+                 gStyleCache->mSVGSheet, true);
+  }
+
   return gStyleCache->mSVGSheet;
 }
 
@@ -348,16 +360,14 @@ nsLayoutStylesheetCache::nsLayoutStylesheetCache()
                mFullScreenOverrideSheet, true);
   LoadSheetURL("chrome://global/content/minimal-xul.css",
                mMinimalXULSheet, true);
-  LoadSheetURL("resource://gre-resources/quirk.css",
-               mQuirkSheet, true);
-  LoadSheetURL("resource://gre/res/svg.css",
-               mSVGSheet, true);
   LoadSheetURL("chrome://global/content/xul.css",
                mXULSheet, true);
 
   // The remaining sheets are created on-demand do to their use being rarer
   // (which helps save memory for Firefox OS apps) or because they need to
-  // be re-loadable in DependentPrefChanged.
+  // be re-loadable in DependentPrefChanged.  quirk.css and svg.css are only
+  // needed once a quirks mode or SVG document shows up, which many content
+  // processes never see.
 }
 
 nsLayoutStylesheetCache::~nsLayoutStylesheetCache()
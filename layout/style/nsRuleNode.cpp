@@ -2256,6 +2256,11 @@ nsRuleNode::WalkRuleTree(const nsStyleStructID aSID,
       break; // We found a rule with fully specified data.  We don't
              // need to go up the tree any further, since the remainder
              // of this branch has already been computed.
+             // We walk from the most specific rule towards the root, so
+             // when the node just above an animation rule has this struct
+             // cached, only the animation rule gets mapped, and
+             // Compute*Data starts from the cached struct (the
+             // aStartStruct path in COMPUTE_START_*).
 
     // Ask the rule to fill in the properties that it specifies.
     nsIStyleRule *rule = ruleNode->mRule;
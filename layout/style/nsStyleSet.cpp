@@ -915,6 +915,11 @@ nsStyleSet::GetContext(nsStyleContext* aParentContext,
     (aFlags & eIsVisitedLink) :
     (aParentContext && aParentContext->RelevantLinkVisited());
 
+  // Siblings that matched the same rules end up with the same rule node, so
+  // this is where identical list and table rows share one style context.
+  // Sharing earlier, before selector matching, would need proof that no
+  // sibling, :nth-*, attribute, state or style-attribute dependency differs
+  // between the elements, which we don't track.
   nsRefPtr<nsStyleContext> result;
   if (aParentContext)
     result = aParentContext->FindChildWithRules(aPseudoTag, aRuleNode,
@@ -752,9 +752,24 @@ StackTrace::Get(Thread* aT)
   StackTrace tmp;
   {
     AutoUnlockState unlock;
+#if defined(XP_MACOSX) && (defined(__i386__) || defined(__x86_64__))
+    // The Mac ABI guarantees frame pointers, and MozStackWalk on x86-64
+    // goes through the much slower _Unwind_Backtrace.  Walk the frame
+    // pointers directly, as the profiler does, to keep the per-allocation
+    // cost down.  The first frame is the return address into our caller,
+    // which MozStackWalk's |skipFrames = 2| below also skips.
+    void** fp = reinterpret_cast<void**>(__builtin_frame_address(0));
+    void* stackEnd = pthread_get_stackaddr_np(pthread_self());
+    uint32_t skipFrames = 1;
+    bool ok = FramePointerStackWalk(StackWalkCallback, skipFrames,
+                                    gOptions->MaxFrames(), &tmp, fp,
+                                    stackEnd);
+#else
     uint32_t skipFrames = 2;
-    if (MozStackWalk(StackWalkCallback, skipFrames,
-                      gOptions->MaxFrames(), &tmp, 0, nullptr)) {
+    bool ok = MozStackWalk(StackWalkCallback, skipFrames,
+                           gOptions->MaxFrames(), &tmp, 0, nullptr);
+#endif
+    if (ok) {
       // Handle the common case first.  All is ok.  Nothing to do.
     } else {
       tmp.mLength = 0;
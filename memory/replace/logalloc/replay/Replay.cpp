@@ -17,6 +17,11 @@ typedef int ssize_t;
 #else
 #include <sys/mman.h>
 #include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
 #endif
 #include <algorithm>
 #include <cstdio>
@@ -341,11 +346,59 @@ size_t parseNumber(Buffer aBuf)
   return result;
 }
 
+/* Monotonic clock, in nanoseconds, used to time the allocator calls. Only
+ * the allocator functions themselves are timed, not the log parsing nor the
+ * memset in Commit. */
+static uint64_t
+NowNs()
+{
+#ifdef _WIN32
+  static LARGE_INTEGER freq;
+  if (!freq.QuadPart) {
+    QueryPerformanceFrequency(&freq);
+  }
+  LARGE_INTEGER now;
+  QueryPerformanceCounter(&now);
+  return uint64_t(now.QuadPart / freq.QuadPart) * 1000000000 +
+         uint64_t(now.QuadPart % freq.QuadPart) * 1000000000 / freq.QuadPart;
+#elif defined(__APPLE__)
+  static mach_timebase_info_data_t timebase;
+  if (!timebase.denom) {
+    mach_timebase_info(&timebase);
+  }
+  return mach_absolute_time() * timebase.numer / timebase.denom;
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return uint64_t(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+/* Number of calls and accumulated time spent in one class of allocator
+ * functions. */
+struct OpTiming
+{
+  OpTiming(): mCount(0), mNs(0) {}
+
+  void Add(uint64_t aStart)
+  {
+    mCount++;
+    mNs += NowNs() - aStart;
+  }
+
+  /* FdPrintf only knows about %zu, so expose the figures as size_t. */
+  size_t Us() const { return size_t(mNs / 1000); }
+  size_t NsPerCall() const { return mCount ? size_t(mNs / mCount) : 0; }
+
+  size_t mCount;
+  uint64_t mNs;
+};
+
 /* Class to handle dispatching the replay function calls to replace-malloc. */
 class Replay
 {
 public:
-  Replay(): mOps(0) {
+  Replay(): mOps(0), mStart(NowNs()) {
 #ifdef _WIN32
     // See comment in FdPrintf.h as to why native win32 handles are used.
     mStdErr = reinterpret_cast<intptr_t>(GetStdHandle(STD_ERROR_HANDLE));
@@ -363,7 +416,9 @@ public:
   {
     mOps++;
     size_t size = parseNumber(aArgs);
+    uint64_t start = NowNs();
     aSlot.mPtr = ::malloc_impl(size);
+    mAlloc.Add(start);
     aSlot.mSize = size;
     Commit(aSlot);
   }
@@ -374,7 +429,10 @@ public:
     size_t alignment = parseNumber(aArgs.SplitChar(','));
     size_t size = parseNumber(aArgs);
     void* ptr;
-    if (::posix_memalign_impl(&ptr, alignment, size) == 0) {
+    uint64_t start = NowNs();
+    int ret = ::posix_memalign_impl(&ptr, alignment, size);
+    mAlloc.Add(start);
+    if (ret == 0) {
       aSlot.mPtr = ptr;
       aSlot.mSize = size;
     } else {
@@ -389,7 +447,9 @@ public:
     mOps++;
     size_t alignment = parseNumber(aArgs.SplitChar(','));
     size_t size = parseNumber(aArgs);
+    uint64_t start = NowNs();
     aSlot.mPtr = ::aligned_alloc_impl(alignment, size);
+    mAlloc.Add(start);
     aSlot.mSize = size;
     Commit(aSlot);
   }
@@ -399,7 +459,9 @@ public:
     mOps++;
     size_t num = parseNumber(aArgs.SplitChar(','));
     size_t size = parseNumber(aArgs);
+    uint64_t start = NowNs();
     aSlot.mPtr = ::calloc_impl(num, size);
+    mAlloc.Add(start);
     aSlot.mSize = size * num;
     Commit(aSlot);
   }
@@ -417,7 +479,9 @@ public:
     void* old_ptr = old_slot.mPtr;
     old_slot.mPtr = nullptr;
     old_slot.mSize = 0;
+    uint64_t start = NowNs();
     aSlot.mPtr = ::realloc_impl(old_ptr, size);
+    mRealloc.Add(start);
     aSlot.mSize = size;
     Commit(aSlot);
   }
@@ -431,7 +495,9 @@ public:
     }
     size_t slot_id = parseNumber(aArgs);
     MemSlot& slot = (*this)[slot_id];
+    uint64_t start = NowNs();
     ::free_impl(slot.mPtr);
+    mFree.Add(start);
     slot.mPtr = nullptr;
     slot.mSize = 0;
   }
@@ -441,7 +507,9 @@ public:
     mOps++;
     size_t alignment = parseNumber(aArgs.SplitChar(','));
     size_t size = parseNumber(aArgs);
+    uint64_t start = NowNs();
     aSlot.mPtr = ::memalign_impl(alignment, size);
+    mAlloc.Add(start);
     aSlot.mSize = size;
     Commit(aSlot);
   }
@@ -450,7 +518,9 @@ public:
   {
     mOps++;
     size_t size = parseNumber(aArgs);
+    uint64_t start = NowNs();
     aSlot.mPtr = ::valloc_impl(size);
+    mAlloc.Add(start);
     aSlot.mSize = size;
     Commit(aSlot);
   }
@@ -471,6 +541,21 @@ public:
      * for the replay internal data. */
   }
 
+  /* Print the number of calls and the time spent in the allocator for each
+   * class of functions, so that allocator changes can be compared by
+   * replaying the same log. */
+  void PrintTimings()
+  {
+    FdPrintf(mStdErr, "#%zu ops in %zu us\n", mOps,
+             size_t((NowNs() - mStart) / 1000));
+    FdPrintf(mStdErr, "#alloc: %zu calls; %zu us; %zu ns/call\n",
+             mAlloc.mCount, mAlloc.Us(), mAlloc.NsPerCall());
+    FdPrintf(mStdErr, "#realloc: %zu calls; %zu us; %zu ns/call\n",
+             mRealloc.mCount, mRealloc.Us(), mRealloc.NsPerCall());
+    FdPrintf(mStdErr, "#free: %zu calls; %zu us; %zu ns/call\n",
+             mFree.mCount, mFree.Us(), mFree.NsPerCall());
+  }
+
 private:
   void Commit(MemSlot& aSlot)
   {
@@ -479,6 +564,10 @@ private:
 
   intptr_t mStdErr;
   size_t mOps;
+  uint64_t mStart;
+  OpTiming mAlloc;
+  OpTiming mRealloc;
+  OpTiming mFree;
   MemSlotList mSlots;
 };
 
@@ -565,5 +654,7 @@ main()
     }
   }
 
+  replay.PrintTimings();
+
   return 0;
 }
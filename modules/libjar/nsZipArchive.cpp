@@ -1144,7 +1144,11 @@ MOZ_WIN_MEM_TRY_BEGIN
     mZs.next_out = buf;
     mZs.avail_out = mBufSize;
     
-    zerr = inflate(&mZs, Z_PARTIAL_FLUSH);
+    // When the rest of the item fits in the buffer, as with nsZipItemPtr,
+    // Z_FINISH lets zlib inflate it in one go without maintaining a
+    // sliding window copy of the output.
+    zerr = inflate(&mZs, mItem->RealSize() - mZs.total_out <= mBufSize ?
+                         Z_FINISH : Z_PARTIAL_FLUSH);
     if (zerr != Z_OK && zerr != Z_STREAM_END)
       return nullptr;
     
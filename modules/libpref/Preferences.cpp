@@ -528,11 +528,10 @@ Preferences::Init()
 
   PREF_Init();
 
-  rv = pref_InitInitialObjects();
-  NS_ENSURE_SUCCESS(rv, rv);
-
   using mozilla::dom::ContentChild;
   if (XRE_IsContentProcess()) {
+    // The parent sends every pref with both its default and user value, so
+    // there's no need to parse the default pref files here as well.
     InfallibleTArray<PrefSetting> prefs;
     ContentChild::GetSingleton()->SendReadPrefsArray(&prefs);
 
@@ -543,6 +542,9 @@ Preferences::Init()
     return NS_OK;
   }
 
+  rv = pref_InitInitialObjects();
+  NS_ENSURE_SUCCESS(rv, rv);
+
   nsXPIDLCString lockFileName;
   /*
    * The following is a small hack which will allow us to only load the library
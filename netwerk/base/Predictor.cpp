@@ -28,6 +28,7 @@
 #include "nsIURI.h"
 #include "nsNetUtil.h"
 #include "nsServiceManagerUtils.h"
+#include "nsTHashtable.h"
 #include "nsThreadUtils.h"
 #ifdef MOZ_NUWA_PROCESS
 #include "ipc/Nuwa.h"
@@ -1198,10 +1199,27 @@ Predictor::RunPredictions(nsINetworkPredictorVerifier *verifier)
   Telemetry::AutoCounter<Telemetry::PREDICTOR_TOTAL_PRECONNECTS> totalPreconnects;
   Telemetry::AutoCounter<Telemetry::PREDICTOR_TOTAL_PRERESOLVES> totalPreresolves;
 
+  // Predictions are made per subresource, so a page that pulls many
+  // resources from one origin would otherwise ask for the same connection or
+  // DNS lookup over and over. Only act once per origin (or host, for DNS),
+  // and don't bother preresolving a host we're already connecting to.
+  nsTHashtable<nsCStringHashKey> connectedOrigins, resolvedHosts;
+
   len = preconnects.Length();
   for (i = 0; i < len; ++i) {
-    PREDICTOR_LOG(("    doing preconnect"));
     nsCOMPtr<nsIURI> uri = preconnects[i];
+    nsAutoCString origin, hostname;
+    if (NS_SUCCEEDED(uri->GetPrePath(origin))) {
+      if (connectedOrigins.Contains(origin)) {
+        PREDICTOR_LOG(("    skipping duplicate preconnect %s", origin.get()));
+        continue;
+      }
+      connectedOrigins.PutEntry(origin);
+    }
+    if (NS_SUCCEEDED(uri->GetAsciiHost(hostname))) {
+      resolvedHosts.PutEntry(hostname);
+    }
+    PREDICTOR_LOG(("    doing preconnect"));
     ++totalPredictions;
     ++totalPreconnects;
     mSpeculativeService->SpeculativeConnect(uri, this);
@@ -1216,10 +1234,15 @@ Predictor::RunPredictions(nsINetworkPredictorVerifier *verifier)
   nsCOMPtr<nsIThread> mainThread = do_GetMainThread();
   for (i = 0; i < len; ++i) {
     nsCOMPtr<nsIURI> uri = preresolves[i];
-    ++totalPredictions;
-    ++totalPreresolves;
     nsAutoCString hostname;
     uri->GetAsciiHost(hostname);
+    if (resolvedHosts.Contains(hostname)) {
+      PREDICTOR_LOG(("    skipping duplicate preresolve %s", hostname.get()));
+      continue;
+    }
+    resolvedHosts.PutEntry(hostname);
+    ++totalPredictions;
+    ++totalPreresolves;
     PREDICTOR_LOG(("    doing preresolve %s", hostname.get()));
     nsCOMPtr<nsICancelable> tmpCancelable;
     mDnsService->AsyncResolve(hostname,
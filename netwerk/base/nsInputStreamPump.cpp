@@ -17,10 +17,18 @@
 #include "nsIStreamListener.h"
 #include "nsILoadGroup.h"
 #include "nsNetCID.h"
+#include "mozilla/TimeStamp.h"
 #include <algorithm>
 
+using mozilla::TimeDuration;
+using mozilla::TimeStamp;
+
 static NS_DEFINE_CID(kStreamTransportServiceCID, NS_STREAMTRANSPORTSERVICE_CID);
 
+// How long a single OnInputStreamReady may keep calling OnDataAvailable for
+// data that is already buffered before yielding back to the event loop.
+static const uint32_t kTransferBudgetMs = 10;
+
 //
 // NSPR_LOG_MODULES=nsStreamPump:5
 //
@@ -402,6 +410,8 @@ nsInputStreamPump::OnInputStreamReady(nsIAsyncInputStream *stream)
     // this function has been called from a PLEvent, so we can safely call
     // any listener or progress sink methods directly from here.
 
+    TimeStamp turnStart = TimeStamp::Now();
+
     for (;;) {
         // There should only be one iteration of this loop happening at a time. 
         // To prevent AsyncWait() (called during callbacks or on other threads)
@@ -479,6 +489,19 @@ nsInputStreamPump::OnInputStreamReady(nsIAsyncInputStream *stream)
         // switching event delivery to another thread.
         if (!mSuspendCount && (stillTransferring || mRetargeting)) {
             mState = nextState;
+
+            // Fast local and cache streams usually have more data ready
+            // as soon as the listener has consumed the last batch. Keep
+            // delivering it for a little while instead of paying for an
+            // AsyncWait and an event loop turn per OnDataAvailable.
+            uint64_t avail;
+            if (stillTransferring && !mRetargeting &&
+                NS_SUCCEEDED(mAsyncStream->Available(&avail)) && avail &&
+                (TimeStamp::Now() - turnStart) <
+                    TimeDuration::FromMilliseconds(kTransferBudgetMs)) {
+                continue;
+            }
+
             mWaitingForInputStreamReady = false;
             nsresult rv = EnsureWaiting();
             if (NS_SUCCEEDED(rv))
@@ -428,6 +428,13 @@ nsSocketTransportService::PollTimeout()
     return PR_SecondsToInterval(minR);
 }
 
+//
+// NOTE: This goes through PR_Poll rather than epoll/kqueue directly because
+// most of our sockets are layered NSPR file descriptors (SSL, SOCKS, ...).
+// PR_Poll calls each layer's poll method, which may rewrite the requested
+// flags (e.g. a TLS layer needing to read in order to make a write
+// progress), and a native readiness backend would bypass those.
+//
 int32_t
 nsSocketTransportService::Poll(bool wait, uint32_t *interval,
                                TimeDuration *pollDuration)
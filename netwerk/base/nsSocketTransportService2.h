@@ -262,6 +262,12 @@ private:
 };
 
 extern nsSocketTransportService *gSocketTransportService;
+
+// The single socket thread.  Much of necko (nsHttpConnectionMgr,
+// Http2Session, nsSocketTransport, the cache tee) asserts that it is running
+// on this thread rather than on the thread that owns a given connection, so
+// sharding connections over several socket threads would first need those
+// checks to become per-connection.
 extern PRThread                 *gSocketThread;
 
 #endif // !nsSocketTransportService_h__
@@ -409,6 +409,17 @@ nsStandardURL::NormalizeIDN(const nsCSubstring &host, nsCString &result)
         }
     }
 
+    // Nearly every host is plain ASCII without labels starting with the ACE
+    // prefix (network.IDN_prefix), and then IDN has nothing to do beyond
+    // lowercasing.  The callers lowercase the host in place when we decline,
+    // so skip the conversion and the copy altogether.
+    bool isACE;
+    if (gIDN && IsASCII(host) &&
+        NS_SUCCEEDED(gIDN->IsACE(host, &isACE)) && !isACE) {
+        result.Truncate();
+        return false;
+    }
+
     if (gIDN &&
         NS_SUCCEEDED(gIDN->ConvertToDisplayIDN(host, &isASCII, result))) {
         if (!isASCII)
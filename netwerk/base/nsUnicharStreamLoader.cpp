@@ -4,6 +4,7 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "mozilla/DebugOnly.h"
+#include "mozilla/unused.h"
 
 #include "nsUnicharStreamLoader.h"
 #include "nsIInputStream.h"
@@ -15,6 +16,8 @@
 // other resource types (e.g. CSS) typically fewer bytes are fine too, since
 // they only look at things right at the beginning of the data.
 #define SNIFFING_BUFFER_SIZE 1024
+// Largest Content-Length we trust enough to reserve the decode buffer for.
+#define MAX_PRESIZE_LENGTH (4 * 1024 * 1024)
 
 using namespace mozilla;
 using mozilla::dom::EncodingUtils;
@@ -188,6 +191,17 @@ nsUnicharStreamLoader::DetermineCharset()
     mDecoder = EncodingUtils::DecoderForEncoding(charset);
   }
 
+  // The decoded length is at most the byte length for the encodings sheets
+  // and scripts actually use, so when the size is known reserve it up front
+  // rather than letting a large resource grow mBuffer a doubling at a time.
+  // This is only an optimization, so if the allocation fails just let the
+  // buffer grow as the data is decoded.
+  int64_t contentLength;
+  if (mChannel && NS_SUCCEEDED(mChannel->GetContentLength(&contentLength)) &&
+      contentLength > 0 && contentLength <= MAX_PRESIZE_LENGTH) {
+    mozilla::unused << mBuffer.SetCapacity(uint32_t(contentLength), fallible);
+  }
+
   // Process the data into mBuffer
   uint32_t dummy;
   rv = WriteSegmentFun(nullptr, this,
@@ -3680,7 +3680,14 @@ CacheFileIOManager::OpenNSPRHandle(CacheFileHandle *aHandle, bool aCreate)
 
     aHandle->mFileExists = true;
   } else {
-    rv = aHandle->mFile->OpenNSPRFileDesc(PR_RDWR, 0600, &aHandle->mFD);
+    // Entries spanning several chunks are read front to back by CacheFile's
+    // chunk preloading, so let the OS read ahead aggressively for them.
+    int32_t flags = PR_RDWR;
+    if (aHandle->mFileSize > kChunkSize) {
+      flags |= nsIFile::OS_READAHEAD;
+    }
+
+    rv = aHandle->mFile->OpenNSPRFileDesc(flags, 0600, &aHandle->mFD);
     if (NS_ERROR_FILE_NOT_FOUND == rv) {
       LOG(("  file doesn't exists"));
       aHandle->mFileExists = false;
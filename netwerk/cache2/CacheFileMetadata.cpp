@@ -209,6 +209,10 @@ CacheFileMetadata::ReadMetadata(CacheFileMetadataListener *aListener)
   }
 
   // round offset to kAlignSize blocks
+  // Note that for files smaller than kAlignSize + kMinMetadataRead this reads
+  // the whole file, data included.  The data part is currently dropped by
+  // ParseMetadata() and read again by the first chunk; handing it over instead
+  // would save small entries a second read.
   offset = (offset / kAlignSize) * kAlignSize;
 
   mBufSize = size - offset;
@@ -9,7 +9,9 @@
 #include "nsISupportsImpl.h"
 #include "nsPrintfCString.h"
 #include "nsThreadUtils.h"
+#include "mozilla/ArrayUtils.h"
 #include "mozilla/IOInterposer.h"
+#include "mozilla/Telemetry.h"
 
 namespace mozilla {
 namespace net {
@@ -92,7 +94,9 @@ nsresult CacheIOThread::DispatchInternal(nsIRunnable* aRunnable, uint32_t aLevel
 
   mMonitor.AssertCurrentThreadOwns();
 
-  mEventQueue[aLevel].AppendElement(aRunnable);
+  Event* event = mEventQueue[aLevel].AppendElement();
+  event->mRunnable = aRunnable;
+  event->mDispatchTime = TimeStamp::NowLoRes();
   if (mLowestLevelWaiting > aLevel)
     mLowestLevelWaiting = aLevel;
 
@@ -259,9 +263,27 @@ static const char* const sLevelTraceName[] = {
   "net::cache::io::level(12)"
 };
 
+// How long events waited in the queue before running, for the levels that
+// readers wait on.  HistogramCount means the level isn't measured.
+static const Telemetry::ID sLevelQueueDelayHistogram[] = {
+  Telemetry::NETWORK_CACHE_V2_IO_QUEUE_DELAY_OPEN_PRIORITY_MS,
+  Telemetry::NETWORK_CACHE_V2_IO_QUEUE_DELAY_READ_PRIORITY_MS,
+  Telemetry::NETWORK_CACHE_V2_IO_QUEUE_DELAY_OPEN_MS,
+  Telemetry::NETWORK_CACHE_V2_IO_QUEUE_DELAY_READ_MS,
+  Telemetry::HistogramCount, // MANAGEMENT
+  Telemetry::HistogramCount, // WRITE
+  Telemetry::HistogramCount, // CLOSE
+  Telemetry::HistogramCount, // INDEX
+  Telemetry::HistogramCount  // EVICT
+};
+
+static_assert(MOZ_ARRAY_LENGTH(sLevelQueueDelayHistogram) ==
+              CacheIOThread::LAST_LEVEL,
+              "Queue delay histograms must match the levels");
+
 void CacheIOThread::LoopOneLevel(uint32_t aLevel)
 {
-  nsTArray<nsCOMPtr<nsIRunnable> > events;
+  nsTArray<Event> events;
   events.SwapElements(mEventQueue[aLevel]);
   uint32_t length = events.Length();
 
@@ -284,7 +306,16 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel)
       // this flag.
       mRerunCurrentEvent = false;
 
-      events[index]->Run();
+      Event& event = events[index];
+      if (!event.mDispatchTime.IsNull() &&
+          sLevelQueueDelayHistogram[aLevel] != Telemetry::HistogramCount) {
+        Telemetry::AccumulateTimeDelta(sLevelQueueDelayHistogram[aLevel],
+                                       event.mDispatchTime,
+                                       TimeStamp::NowLoRes());
+      }
+      event.mDispatchTime = TimeStamp();
+
+      event.mRunnable->Run();
 
       if (mRerunCurrentEvent) {
         // The event handler yields to higher priority events and wants to rerun.
@@ -293,7 +324,7 @@ void CacheIOThread::LoopOneLevel(uint32_t aLevel)
       }
 
       // Release outside the lock.
-      events[index] = nullptr;
+      event.mRunnable = nullptr;
     }
   }
 
@@ -13,6 +13,7 @@
 #include "mozilla/Monitor.h"
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Atomics.h"
+#include "mozilla/TimeStamp.h"
 
 class nsIRunnable;
 
@@ -84,6 +85,14 @@ private:
   nsresult DispatchInternal(nsIRunnable* aRunnable, uint32_t aLevel);
   bool YieldInternal();
 
+  struct Event
+  {
+    nsCOMPtr<nsIRunnable> mRunnable;
+    // When the event was dispatched, for the queue delay telemetry.  Cleared
+    // once reported so that yielded and rerun events are only counted once.
+    TimeStamp mDispatchTime;
+  };
+
   static CacheIOThread* sSelf;
 
   mozilla::Monitor mMonitor;
@@ -91,7 +100,7 @@ private:
   nsCOMPtr<nsIThread> mXPCOMThread;
   Atomic<uint32_t, Relaxed> mLowestLevelWaiting;
   uint32_t mCurrentlyExecutingLevel;
-  nsTArray<nsCOMPtr<nsIRunnable> > mEventQueue[LAST_LEVEL];
+  nsTArray<Event> mEventQueue[LAST_LEVEL];
 
   Atomic<bool, Relaxed> mHasXPCOMEvents;
   bool mRerunCurrentEvent;
@@ -27,6 +27,11 @@
 #define kMinUnwrittenChanges   300
 #define kMinDumpInterval       20000 // in milliseconds
 #define kMaxBufSize            16384
+// Reading the index and the journal happens one asynchronous read per buffer,
+// and large indexes have hundreds of thousands of records, so use a bigger
+// buffer there to cut down the number of round trips to the IO thread.  The
+// buffer only lives until the read is done.
+#define kMaxReadBufSize        131072
 #define kIndexVersion          0x00000001
 #define kUpdateIndexStartDelay 50000 // in milliseconds
 
@@ -3174,7 +3179,7 @@ CacheIndex::AllocBuffer()
       }
       break;
     case READING:
-      mRWBufSize = kMaxBufSize;
+      mRWBufSize = kMaxReadBufSize;
       break;
     default:
       MOZ_ASSERT(false, "Unexpected state!");
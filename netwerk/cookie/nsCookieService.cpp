@@ -2804,6 +2804,16 @@ nsCookieService::GetCookieStringInternal(nsIURI *aHostURI,
   // then sort by creation time (see bug 236772).
   foundCookieList.Sort(CompareCookiesForSending());
 
+  // sites commonly send dozens of cookies, so size the result once up front
+  // rather than letting it regrow with every append below.
+  uint32_t cookieStringLength = aCookieString.Length();
+  for (int32_t i = 0; i < count; ++i) {
+    cookie = foundCookieList.ElementAt(i);
+    cookieStringLength += cookie->Name().Length() + cookie->Value().Length() +
+                          3; // "=" and "; "
+  }
+  aCookieString.SetCapacity(cookieStringLength);
+
   for (int32_t i = 0; i < count; ++i) {
     cookie = foundCookieList.ElementAt(i);
 
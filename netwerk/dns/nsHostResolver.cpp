@@ -1066,6 +1066,7 @@ nsHostResolver::IssueLookup(nsHostRecord *rec)
     
     rec->resolving = true;
     rec->onQueue = true;
+    rec->mQueueStart = TimeStamp::NowLoRes();
 
     rv = ConditionallyCreateThread(rec);
     
@@ -1104,6 +1105,25 @@ nsHostResolver::DeQueue(PRCList &aQ, nsHostRecord **aResult)
     PR_REMOVE_AND_INIT_LINK(*aResult);
     mPendingCount--;
     (*aResult)->onQueue = false;
+
+    // Report how long the record waited for a resolver thread.  Records can
+    // move to a higher priority queue while waiting, so use the one it
+    // leaves from.
+    Telemetry::ID histogramID;
+    switch (nsHostRecord::GetPriority((*aResult)->flags)) {
+        case nsHostRecord::DNS_PRIORITY_HIGH:
+            histogramID = Telemetry::DNS_QUEUE_WAIT_HIGH_PRIORITY;
+            break;
+        case nsHostRecord::DNS_PRIORITY_MEDIUM:
+            histogramID = Telemetry::DNS_QUEUE_WAIT_MEDIUM_PRIORITY;
+            break;
+        case nsHostRecord::DNS_PRIORITY_LOW:
+        default:
+            histogramID = Telemetry::DNS_QUEUE_WAIT_LOW_PRIORITY;
+            break;
+    }
+    Telemetry::AccumulateTimeDelta(histogramID, (*aResult)->mQueueStart,
+                                   TimeStamp::NowLoRes());
 }
 
 bool
@@ -95,7 +95,8 @@ public:
 
     // When the record enters its grace period. This must be before mValidEnd.
     // If a record is in its grace period (and not expired), it will be used
-    // but a request to refresh it will be made.
+    // but a request to refresh it will be made, i.e. stale-while-revalidate.
+    // The length of the grace period is network.dnsCacheExpirationGracePeriod.
     mozilla::TimeStamp mGraceStart;
 
     // Convenience function for setting the timestamps above (mValidStart,
@@ -135,6 +136,7 @@ private:
                         * one of the worker threads. */
 
     bool    onQueue;  /* true if pending and on the queue (not yet given to getaddrinfo())*/
+    mozilla::TimeStamp mQueueStart; /* when the record was put on a pending queue */
     bool    usingAnyThread; /* true if off queue and contributing to mActiveAnyThreadCount */
     bool    mDoomed; /* explicitly expired */
 
@@ -16,6 +16,7 @@
 #include "Http2Compression.h"
 #include "Http2HuffmanIncoming.h"
 #include "Http2HuffmanOutgoing.h"
+#include "nsDataHashtable.h"
 
 extern PRThread *gSocketThread;
 
@@ -24,18 +25,28 @@ namespace net {
 
 static nsDeque *gStaticHeaders = nullptr;
 
+// Maps a header name to the index of its first entry in gStaticHeaders. The
+// static table keeps all the entries for a given name next to each other, so
+// the compressor only has to walk forward from there to find a value.
+static nsDataHashtable<nsCStringHashKey, uint32_t> *gStaticReverse = nullptr;
+
 void
 Http2CompressionCleanup()
 {
   // this happens after the socket thread has been destroyed
   delete gStaticHeaders;
   gStaticHeaders = nullptr;
+  delete gStaticReverse;
+  gStaticReverse = nullptr;
 }
 
 static void
 AddStaticElement(const nsCString &name, const nsCString &value)
 {
   nvPair *pair = new nvPair(name, value);
+  if (!gStaticReverse->Contains(name)) {
+    gStaticReverse->Put(name, gStaticHeaders->GetSize());
+  }
   gStaticHeaders->Push(pair);
 }
 
@@ -51,6 +62,7 @@ InitializeStaticHeaders()
   MOZ_ASSERT(PR_GetCurrentThread() == gSocketThread);
   if (!gStaticHeaders) {
     gStaticHeaders = new nsDeque();
+    gStaticReverse = new nsDataHashtable<nsCStringHashKey, uint32_t>();
     AddStaticElement(NS_LITERAL_CSTRING(":authority"));
     AddStaticElement(NS_LITERAL_CSTRING(":method"), NS_LITERAL_CSTRING("GET"));
     AddStaticElement(NS_LITERAL_CSTRING(":method"), NS_LITERAL_CSTRING("POST"));
@@ -1053,6 +1065,22 @@ Http2Compressor::HuffmanAppend(const nsCString &value)
   uint32_t offset;
   uint8_t *startByte;
 
+  // Huffman coding only pays off when it actually shrinks the string, and
+  // for tokens, hashes and base64 values it often doesn't. The code lengths
+  // are fixed, so work out the encoded size up front and send the literal
+  // as-is (H bit clear) when it would not be any shorter.
+  uint32_t huffBits = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    huffBits += HuffmanOutgoing[static_cast<uint8_t>(value[i])].mLength;
+  }
+  if (((huffBits + 7) / 8) >= length) {
+    EncodeInteger(7, length);
+    mOutput->Append(value);
+    LOG(("Http2Compressor::HuffmanAppend %p sent %d byte original as raw "
+         "literal.\n", this, length));
+    return;
+  }
+
   for (uint32_t i = 0; i < length; ++i) {
     uint8_t idx = static_cast<uint8_t>(value[i]);
     uint8_t huffLength = HuffmanOutgoing[idx].mLength;
@@ -1131,8 +1159,29 @@ Http2Compressor::ProcessHeader(const nvPair inputPair, bool noLocalIndex,
   LOG(("Http2Compressor::ProcessHeader %s %s", inputPair.mName.get(),
        inputPair.mValue.get()));
 
+  // The static part of the table never changes, so find it through the
+  // reverse hash rather than comparing against every entry.
+  uint32_t staticLength = mHeaderTable.StaticLength();
+  uint32_t staticIndex;
+  if (gStaticReverse->Get(inputPair.mName, &staticIndex)) {
+    nameReference = staticIndex + 1;
+    for (uint32_t index = staticIndex;
+         index < staticLength &&
+         mHeaderTable[index]->mName.Equals(inputPair.mName);
+         ++index) {
+      if (mHeaderTable[index]->mValue.Equals(inputPair.mValue)) {
+        match = true;
+        matchedIndex = index;
+        break;
+      }
+    }
+  }
+
+  // The dynamic part is bounded by mMaxBuffer and renumbered on every
+  // insertion, so a plain scan is still the cheapest way through it.
   // NWGH - make this index = 1; index <= headerTableSize; ++index
-  for (uint32_t index = 0; index < headerTableSize; ++index) {
+  for (uint32_t index = staticLength; !match && index < headerTableSize;
+       ++index) {
     if (mHeaderTable[index]->mName.Equals(inputPair.mName)) {
       // NWGH - make this nameReference = index
       nameReference = index + 1;
@@ -553,6 +553,21 @@ Http2Session::FlushOutputQueue()
   }
 }
 
+// Returns true when flushing the output queue now would be wasteful: other
+// streams are ready to add their frames in this write pass, and the queue
+// (plus aIncoming more bytes) is still short of a full TLS record. The
+// aIncoming bytes must also fit behind the data already in the queue without
+// flushing or realigning it; after a partial write most of mOutputQueueUsed
+// may already have been sent, and holding back then would only make
+// CommitToSegmentSize return NS_BASE_STREAM_WOULD_BLOCK over and over.
+bool
+Http2Session::ShouldCoalesceOutput(uint32_t aIncoming)
+{
+  return GetWriteQueueSize() &&
+    (AmountOfOutputBuffered() + aIncoming) < kQueueCoalesceSize &&
+    (mOutputQueueUsed + aIncoming) <= (mOutputQueueSize - kQueueReserved);
+}
+
 void
 Http2Session::DontReuse()
 {
@@ -2291,8 +2306,13 @@ Http2Session::ReadSegments(nsAHttpSegmentReader *reader,
   // Not every permutation of stream->ReadSegents produces data (and therefore
   // tries to flush the output queue) - SENDING_FIN_STREAM can be an example
   // of that. But we might still have old data buffered that would be good
-  // to flush.
-  FlushOutputQueue();
+  // to flush - unless more streams are about to add to it, in which case
+  // make sure we get called again rather than writing a short record.
+  if (ShouldCoalesceOutput(0)) {
+    SetWriteCallbacks();
+  } else {
+    FlushOutputQueue();
+  }
 
   // Allow new server reads - that might be data or control information
   // (e.g. window updates or http replies) that are responses to these writes
@@ -3065,7 +3085,7 @@ Http2Session::OnReadSegment(const char *buf,
 nsresult
 Http2Session::CommitToSegmentSize(uint32_t count, bool forceCommitment)
 {
-  if (mOutputQueueUsed)
+  if (mOutputQueueUsed && !ShouldCoalesceOutput(count))
     FlushOutputQueue();
 
   // would there be enough room to buffer this if needed?
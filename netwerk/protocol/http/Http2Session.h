@@ -136,6 +136,11 @@ public:
   const static uint32_t kQueueTailRoom    =  4096;
   const static uint32_t kQueueReserved    =  1024;
 
+  // While other streams are waiting to write, frames are held back in the
+  // output queue until about this much has accumulated so that they can go
+  // out together in a single full-sized TLS record.
+  const static uint32_t kQueueCoalesceSize = 16384;
+
   const static uint32_t kMaxStreamID = 0x7800000;
 
   // This is a sentinel for a deleted stream. It is not a valid
@@ -202,6 +207,7 @@ public:
   nsresult BufferOutput(const char *, uint32_t, uint32_t *);
   void     FlushOutputQueue();
   uint32_t AmountOfOutputBuffered() { return mOutputQueueUsed - mOutputQueueSent; }
+  bool     ShouldCoalesceOutput(uint32_t aIncoming);
 
   uint32_t GetServerInitialStreamWindow() { return mServerInitialStreamWindow; }
 
@@ -904,6 +904,11 @@ HttpChannelParent::OnDataAvailable(nsIRequest *aRequest,
   MOZ_RELEASE_ASSERT(!mDivertingFromChild,
     "Cannot call OnDataAvailable if diverting is set!");
 
+  // Each OnDataAvailable is forwarded as its own message: the data is copied
+  // once here and once more into the IPC message, and the child wraps it in a
+  // dependent stream without copying again. Holding ODAs back to coalesce them
+  // would need a flush on every other parent->child message to keep ordering
+  // with OnStatus/OnProgress/OnStopRequest, so we don't.
   nsCString data;
   nsresult rv = NS_ReadInputStreamToString(aInputStream, data, aCount);
   if (NS_FAILED(rv))
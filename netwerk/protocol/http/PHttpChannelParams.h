@@ -71,8 +71,9 @@ struct ParamTraits<mozilla::net::nsHttpAtom>
   {
     // aParam.get() cannot be null.
     MOZ_ASSERT(aParam.get(), "null nsHTTPAtom value");
-    nsAutoCString value(aParam.get());
-    WriteParam(aMsg, value);
+    // Atom strings live as long as the atom table, so there is no need to
+    // copy them just to serialize them.
+    ParamTraits<nsACString>::Write(aMsg, nsDependentCString(aParam.get()));
   }
 
   static bool Read(const Message* aMsg, void** aIter, paramType* aResult)
@@ -255,6 +255,7 @@ nsHttpChannel::nsHttpChannel()
     , mIsPartialRequest(0)
     , mHasAutoRedirectVetoNotifier(0)
     , mIsPackagedAppResource(0)
+    , mDeliveryRetargeted(0)
     , mPushedStream(nullptr)
     , mLocalBlocklist(false)
     , mWarningReporter(nullptr)
@@ -5771,6 +5772,11 @@ nsHttpChannel::OnStopRequest(nsIRequest *request, nsISupports *ctxt, nsresult st
     mIsPending = false;
     mStatus = status;
 
+    if (NS_SUCCEEDED(status)) {
+        Telemetry::Accumulate(Telemetry::HTTP_OFFMAIN_THREAD_DELIVERY,
+                              mDeliveryRetargeted);
+    }
+
     // perform any final cache operations before we close the cache entry.
     if (mCacheEntry && mRequestTimeInitialized) {
         bool writeAccess;
@@ -5986,12 +5992,14 @@ nsHttpChannel::RetargetDeliveryTo(nsIEventTarget* aNewTarget)
         // nsInputStreamPump should implement this interface.
         MOZ_ASSERT(retargetableCachePump);
         rv = retargetableCachePump->RetargetDeliveryTo(aNewTarget);
+        mDeliveryRetargeted = NS_SUCCEEDED(rv);
     }
     if (NS_SUCCEEDED(rv) && mTransactionPump) {
         retargetableTransactionPump = do_QueryObject(mTransactionPump);
         // nsInputStreamPump should implement this interface.
         MOZ_ASSERT(retargetableTransactionPump);
         rv = retargetableTransactionPump->RetargetDeliveryTo(aNewTarget);
+        mDeliveryRetargeted = NS_SUCCEEDED(rv);
 
         // If retarget fails for transaction pump, we must restore mCachePump.
         if (NS_FAILED(rv) && retargetableCachePump) {
@@ -483,6 +483,9 @@ private:
     // Upon successfully fetching the package, the resource will be placed in
     // the cache, and served by calling OnCacheEntryAvailable.
     uint32_t                          mIsPackagedAppResource : 1;
+    // True once a listener has successfully moved OnDataAvailable delivery
+    // off the main thread through RetargetDeliveryTo.
+    uint32_t                          mDeliveryRetargeted : 1;
 
     nsTArray<nsContinueRedirectionFunc> mRedirectFuncStack;
 
@@ -118,6 +118,10 @@ private:
 // nsHttpHeaderArray <private>: inline functions
 //-----------------------------------------------------------------------------
 
+// Header names are atoms, so matching an entry is a single pointer compare.
+// With the few dozen headers a message carries, walking the array is cheaper
+// than hashing and keeps the entries in wire order for Flatten().
+
 inline int32_t
 nsHttpHeaderArray::LookupEntry(nsHttpAtom header, const nsEntry **entry) const
 {
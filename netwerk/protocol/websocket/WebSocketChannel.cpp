@@ -870,12 +870,29 @@ public:
     Bytef trailingData[] = { 0x00, 0x00, 0xFF, 0xFF };
     bool trailingDataUsed = false;
 
-    mInflater.avail_out = kBufferLen;
-    mInflater.next_out = mBuffer;
+    // Inflate straight into _retval rather than going through mBuffer and
+    // appending, growing the string geometrically as it fills up.
+    uint32_t written = _retval.Length();
+
     mInflater.avail_in = dataLen;
     mInflater.next_in = data;
 
     while (true) {
+      if (written == _retval.Length()) {
+        uint32_t grow = std::max(uint32_t(kBufferLen),
+                                 std::max(written, dataLen));
+        if (grow > UINT32_MAX - written ||
+            !_retval.SetLength(written + grow, fallible)) {
+          _retval.SetLength(written);
+          return NS_ERROR_OUT_OF_MEMORY;
+        }
+      }
+
+      uint32_t room = _retval.Length() - written;
+      mInflater.avail_out = room;
+      mInflater.next_out =
+        reinterpret_cast<Bytef *>(_retval.BeginWriting()) + written;
+
       int zerr = inflate(&mInflater, Z_NO_FLUSH);
 
       if (zerr == Z_STREAM_END) {
@@ -891,22 +908,17 @@ public:
         mInflater.next_out = saveNextOut;
         mInflater.avail_out = saveAvailOut;
       } else if (zerr != Z_OK && zerr != Z_BUF_ERROR) {
+        _retval.SetLength(written);
         return NS_ERROR_INVALID_CONTENT_ENCODING;
       }
 
-      uint32_t inflated = kBufferLen - mInflater.avail_out;
-      if (inflated > 0) {
-        _retval.Append(reinterpret_cast<char *>(mBuffer), inflated);
-      }
-
-      mInflater.avail_out = kBufferLen;
-      mInflater.next_out = mBuffer;
+      written += room - mInflater.avail_out;
 
       if (mInflater.avail_in > 0) {
         continue; // There is still some data to inflate
       }
 
-      if (inflated == kBufferLen) {
+      if (!mInflater.avail_out) {
         continue; // There was not enough space in the buffer
       }
 
@@ -917,6 +929,7 @@ public:
         continue;
       }
 
+      _retval.SetLength(written);
       return NS_OK;
     }
   }
@@ -14,6 +14,21 @@
 #include "nsComponentManagerUtils.h"
 #include "nsThreadUtils.h"
 #include "mozilla/Preferences.h"
+#include "mozilla/Telemetry.h"
+
+#include <algorithm>
+
+// The output buffer is sized from the input chunks, but a gzipped text
+// response typically inflates to several times its size so a small first
+// chunk would otherwise split every later chunk into many downstream
+// OnDataAvailable calls.
+static const uint32_t kMinOutBufferLen = 32 * 1024;
+
+// Responses that inflate to less than this are not reported to
+// HTTP_INFLATE_US_PER_MB; their time is mostly fixed overhead.
+static const uint64_t kMinInflatedBytesForTelemetry = 64 * 1024;
+
+using namespace mozilla;
 
 // nsISupports implementation
 NS_IMPL_ISUPPORTS(nsHTTPCompressConv,
@@ -35,6 +50,7 @@ nsHTTPCompressConv::nsHTTPCompressConv()
     , hMode(0)
     , mSkipCount(0)
     , mFlags(0)
+    , mInflatedBytes(0)
 {
     if (NS_IsMainThread()) {
         mFailUncleanStops =
@@ -99,6 +115,13 @@ nsHTTPCompressConv::OnStopRequest(nsIRequest* request, nsISupports *aContext,
         // This is not a clean end of gzip stream: the transfer is incomplete.
         aStatus = NS_ERROR_NET_PARTIAL_TRANSFER;
     }
+
+    if (mInflatedBytes >= kMinInflatedBytesForTelemetry) {
+        double usPerMB = mInflateTime.ToMicroseconds() * (1024 * 1024) /
+                         mInflatedBytes;
+        Telemetry::Accumulate(Telemetry::HTTP_INFLATE_US_PER_MB,
+                              uint32_t(usPerMB));
+    }
     return mListener->OnStopRequest(request, aContext, aStatus);
 }
 
@@ -147,7 +170,7 @@ nsHTTPCompressConv::OnDataAvailable(nsIRequest* request,
                 mInpBuffer = (unsigned char *) realloc(mInpBuffer, mInpBufferLen = streamLen);
 
                 if (mOutBufferLen < streamLen * 2)
-                    mOutBuffer = (unsigned char *) realloc(mOutBuffer, mOutBufferLen = streamLen * 3);
+                    mOutBuffer = (unsigned char *) realloc(mOutBuffer, mOutBufferLen = std::max(streamLen * 3, kMinOutBufferLen));
 
                 if (mInpBuffer == nullptr || mOutBuffer == nullptr)
                     return NS_ERROR_OUT_OF_MEMORY;
@@ -157,7 +180,7 @@ nsHTTPCompressConv::OnDataAvailable(nsIRequest* request,
                 mInpBuffer = (unsigned char *) malloc(mInpBufferLen = streamLen);
 
             if (mOutBuffer == nullptr)
-                mOutBuffer = (unsigned char *) malloc(mOutBufferLen = streamLen * 3);
+                mOutBuffer = (unsigned char *) malloc(mOutBufferLen = std::max(streamLen * 3, kMinOutBufferLen));
 
             if (mInpBuffer == nullptr || mOutBuffer == nullptr)
                 return NS_ERROR_OUT_OF_MEMORY;
@@ -185,8 +208,11 @@ nsHTTPCompressConv::OnDataAvailable(nsIRequest* request,
                     d_stream.next_out = mOutBuffer;
                     d_stream.avail_out = (uInt)mOutBufferLen;
 
+                    TimeStamp inflateStart = TimeStamp::Now();
                     int code = inflate(&d_stream, Z_NO_FLUSH);
+                    mInflateTime += TimeStamp::Now() - inflateStart;
                     unsigned bytesWritten = (uInt)mOutBufferLen - d_stream.avail_out;
+                    mInflatedBytes += bytesWritten;
 
                     if (code == Z_STREAM_END)
                     {
@@ -272,8 +298,11 @@ nsHTTPCompressConv::OnDataAvailable(nsIRequest* request,
                     d_stream.next_out  = mOutBuffer;
                     d_stream.avail_out = (uInt)mOutBufferLen;
 
+                    TimeStamp inflateStart = TimeStamp::Now();
                     int code = inflate (&d_stream, Z_NO_FLUSH);
+                    mInflateTime += TimeStamp::Now() - inflateStart;
                     unsigned bytesWritten = (uInt)mOutBufferLen - d_stream.avail_out;
+                    mInflatedBytes += bytesWritten;
 
                     if (code == Z_STREAM_END)
                     {
@@ -8,6 +8,7 @@
 
 #include "nsIStreamConverter.h"
 #include "nsCOMPtr.h"
+#include "mozilla/TimeStamp.h"
 
 #include "zlib.h"
 
@@ -80,6 +81,11 @@ private:
     z_stream d_stream;
     unsigned mLen, hMode, mSkipCount, mFlags;
 
+    // Time spent in inflate() and the number of bytes it produced, for
+    // telemetry.
+    mozilla::TimeDuration mInflateTime;
+    uint64_t mInflatedBytes;
+
     uint32_t check_header (nsIInputStream *iStr, uint32_t streamLen, nsresult *rv);
 };
 
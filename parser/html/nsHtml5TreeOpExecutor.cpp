@@ -6,6 +6,8 @@
 
 #include "mozilla/DebugOnly.h"
 #include "mozilla/Likely.h"
+#include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 
 #include "nsError.h"
 #include "nsHtml5TreeOpExecutor.h"
@@ -333,6 +335,14 @@ class nsHtml5FlushLoopGuard
     }
 };
 
+static void
+AccumulateFlushTelemetry(uint32_t aOpsPerformed, const TimeStamp& aStart)
+{
+  Telemetry::Accumulate(Telemetry::HTML5_TREE_OP_FLUSH_OPS, aOpsPerformed);
+  Telemetry::AccumulateTimeDelta(Telemetry::HTML5_TREE_OP_FLUSH_TIME_MS,
+                                 aStart);
+}
+
 /**
  * The purpose of the loop here is to avoid returning to the main event loop
  */
@@ -431,6 +441,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
 
     nsIContent* scriptElement = nullptr;
     
+    TimeStamp flushStart = TimeStamp::Now();
     BeginDocUpdate();
 
     uint32_t numberOfOpsToFlush = mOpQueue.Length();
@@ -458,6 +469,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
         mOpQueue.RemoveElementsAt(0, (iter - first) + 1);
         
         EndDocUpdate();
+        AccumulateFlushTelemetry((iter - first) + 1, flushStart);
 
         mFlushState = eNotFlushing;
 
@@ -474,6 +486,7 @@ nsHtml5TreeOpExecutor::RunFlushLoop()
     mOpQueue.Clear();
     
     EndDocUpdate();
+    AccumulateFlushTelemetry(numberOfOpsToFlush, flushStart);
 
     mFlushState = eNotFlushing;
 
@@ -266,8 +266,16 @@ nsNSSSocketInfo::SetHandshakeCompleted()
                                 : NotAllowedToFalseStart;
 
     // This will include TCP and proxy tunnel wait time
+    TimeStamp now = TimeStamp::Now();
     Telemetry::AccumulateTimeDelta(Telemetry::SSL_TIME_UNTIL_HANDSHAKE_FINISHED,
-                                   mSocketCreationTimestamp, TimeStamp::Now());
+                                   mSocketCreationTimestamp, now);
+
+    // Split out by whether the session was resumed, so that the saving from
+    // the session cache is visible on its own.
+    Telemetry::AccumulateTimeDelta(handshakeType == Resumption
+      ? Telemetry::SSL_TIME_UNTIL_HANDSHAKE_FINISHED_RESUMED
+      : Telemetry::SSL_TIME_UNTIL_HANDSHAKE_FINISHED_FULL,
+      mSocketCreationTimestamp, now);
 
     // If the handshake is completed for the first time from just 1 callback
     // that means that TLS session resumption must have been used.
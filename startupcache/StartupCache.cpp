@@ -33,6 +33,7 @@
 #include "mozilla/Omnijar.h"
 #include "prenv.h"
 #include "mozilla/Telemetry.h"
+#include "mozilla/TimeStamp.h"
 #include "nsThreadUtils.h"
 #include "nsXULAppAPI.h"
 #include "nsIProtocolHandler.h"
@@ -319,9 +320,13 @@ StartupCache::GetBuffer(const char* id, char** outbuf, uint32_t* length)
     }
   }
 
+  TimeStamp start = TimeStamp::Now();
   nsresult rv = GetBufferFromZipArchive(mArchive, true, id, outbuf, length);
-  if (NS_SUCCEEDED(rv))
+  if (NS_SUCCEEDED(rv)) {
+    Telemetry::Accumulate(Telemetry::STARTUP_CACHE_READ_US,
+      uint32_t((TimeStamp::Now() - start).ToMicroseconds()));
     return rv;
+  }
 
   nsRefPtr<nsZipArchive> omnijar = mozilla::Omnijar::GetReader(mozilla::Omnijar::APP);
   // no need to checksum omnijarred entries
@@ -418,7 +423,10 @@ CacheCloseHelper(const nsACString& key, const CacheEntry* data,
   NS_ASSERTION(NS_SUCCEEDED(rv) && hasEntry == false, 
                "Existing entry in disk StartupCache.");
 #endif
-  rv = writer->AddEntryStream(key, holder->time, true, stream, false);
+  // Store entries uncompressed: they are read back from the mmapped archive
+  // during startup, when inflating them costs more than the extra disk space.
+  rv = writer->AddEntryStream(key, holder->time,
+                              nsIZipWriter::COMPRESSION_NONE, stream, false);
 
   if (NS_FAILED(rv)) {
     NS_WARNING("cache entry deleted but not written to disk.");
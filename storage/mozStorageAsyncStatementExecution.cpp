@@ -204,6 +204,7 @@ AsyncExecuteStatements::AsyncExecuteStatements(StatementDataArray &aStatements,
 , mHasTransaction(false)
 , mCallback(aCallback)
 , mCallingThread(::do_GetCurrentThread())
+, mColumnNamesStatement(nullptr)
 , mMaxWait(TimeDuration::FromMilliseconds(MAX_MILLISECONDS_BETWEEN_RESULTS))
 , mIntervalStart(TimeStamp::Now())
 , mState(PENDING)
@@ -397,10 +398,15 @@ AsyncExecuteStatements::buildAndNotifyResults(sqlite3_stmt *aStatement)
     mResultSet = new ResultSet();
   NS_ENSURE_TRUE(mResultSet, NS_ERROR_OUT_OF_MEMORY);
 
+  if (!mColumnNames || mColumnNamesStatement != aStatement) {
+    mColumnNames = new RowColumnNames(aStatement);
+    mColumnNamesStatement = aStatement;
+  }
+
   nsRefPtr<Row> row(new Row());
   NS_ENSURE_TRUE(row, NS_ERROR_OUT_OF_MEMORY);
 
-  nsresult rv = row->initialize(aStatement);
+  nsresult rv = row->initialize(aStatement, mColumnNames);
   NS_ENSURE_SUCCESS(rv, rv);
 
   rv = mResultSet->add(row);
@@ -586,6 +592,11 @@ AsyncExecuteStatements::Run()
   if (mState == CANCELED)
     return notifyComplete();
 
+  // All async statements for a connection share one execution thread, so
+  // record how long this request waited behind the ones queued before it.
+  Telemetry::AccumulateTimeDelta(Telemetry::MOZ_STORAGE_ASYNC_REQUESTS_QUEUE_MS,
+                                 mRequestStartDate);
+
   if (statementsNeedTransaction() && mConnection->getAutocommit()) {
     if (NS_SUCCEEDED(mConnection->beginTransactionInternal(mNativeConnection,
                                                            mozIStorageConnection::TRANSACTION_IMMEDIATE))) {
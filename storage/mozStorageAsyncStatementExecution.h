@@ -27,6 +27,7 @@ namespace storage {
 
 class Connection;
 class ResultSet;
+class RowColumnNames;
 class StatementData;
 
 class AsyncExecuteStatements final : public nsIRunnable
@@ -190,6 +191,13 @@ private:
   nsCOMPtr<nsIThread> mCallingThread;
   nsRefPtr<ResultSet> mResultSet;
 
+  /**
+   * The column names of the statement whose rows we are currently building,
+   * shared by all of those rows.  mColumnNamesStatement is that statement.
+   */
+  nsRefPtr<RowColumnNames> mColumnNames;
+  sqlite3_stmt *mColumnNamesStatement;
+
   /**
    * The maximum amount of time we want to wait between results.  Defined by
    * MAX_MILLISECONDS_BETWEEN_RESULTS and set at construction.
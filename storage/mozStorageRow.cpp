@@ -14,14 +14,33 @@
 namespace mozilla {
 namespace storage {
 
+////////////////////////////////////////////////////////////////////////////////
+//// RowColumnNames
+
+RowColumnNames::RowColumnNames(sqlite3_stmt *aStatement)
+{
+  int numCols = ::sqlite3_column_count(aStatement);
+  for (int i = 0; i < numCols; i++) {
+    // Associate the name (if any) with the index
+    const char *name = ::sqlite3_column_name(aStatement, i);
+    if (!name) break;
+    nsAutoCString colName(name);
+    mNameHashtable.Put(colName, i);
+  }
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 //// Row
 
 nsresult
-Row::initialize(sqlite3_stmt *aStatement)
+Row::initialize(sqlite3_stmt *aStatement, RowColumnNames *aColumnNames)
 {
+  MOZ_ASSERT(aColumnNames);
+  mColumnNames = aColumnNames;
+
   // Get the number of results
   mNumCols = ::sqlite3_column_count(aStatement);
+  mData.SetCapacity(mNumCols);
 
   // Start copying over values
   for (uint32_t i = 0; i < mNumCols; i++) {
@@ -60,12 +79,6 @@ Row::initialize(sqlite3_stmt *aStatement)
 
     // Insert into our storage array
     NS_ENSURE_TRUE(mData.InsertObjectAt(variant, i), NS_ERROR_OUT_OF_MEMORY);
-
-    // Associate the name (if any) with the index
-    const char *name = ::sqlite3_column_name(aStatement, i);
-    if (!name) break;
-    nsAutoCString colName(name);
-    mNameHashtable.Put(colName, i);
   }
 
   return NS_OK;
@@ -98,7 +111,7 @@ Row::GetResultByName(const nsACString &aName,
                      nsIVariant **_result)
 {
   uint32_t index;
-  NS_ENSURE_TRUE(mNameHashtable.Get(aName, &index), NS_ERROR_NOT_AVAILABLE);
+  NS_ENSURE_TRUE(mColumnNames->get(aName, &index), NS_ERROR_NOT_AVAILABLE);
   return GetResultByIndex(index, _result);
 }
 
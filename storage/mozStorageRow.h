@@ -10,6 +10,7 @@
 #include "mozIStorageRow.h"
 #include "nsCOMArray.h"
 #include "nsDataHashtable.h"
+#include "nsRefPtr.h"
 #include "mozilla/Attributes.h"
 class nsIVariant;
 struct sqlite3_stmt;
@@ -17,6 +18,38 @@ struct sqlite3_stmt;
 namespace mozilla {
 namespace storage {
 
+/**
+ * Maps the result column names of a statement to their indices.  The names are
+ * the same for every row the statement returns, so one instance is shared by
+ * all of those rows instead of each row building its own table.
+ */
+class RowColumnNames final
+{
+public:
+  NS_INLINE_DECL_THREADSAFE_REFCOUNTING(RowColumnNames)
+
+  /**
+   * Reads the column names of the given statement.
+   *
+   * @param aStatement
+   *        The sqlite statement to pull column names from.
+   */
+  explicit RowColumnNames(sqlite3_stmt *aStatement);
+
+  bool get(const nsACString &aName, uint32_t *_index) const
+  {
+    return mNameHashtable.Get(aName, _index);
+  }
+
+private:
+  ~RowColumnNames() {}
+
+  /**
+   * Maps a given name to a column index.
+   */
+  nsDataHashtable<nsCStringHashKey, uint32_t> mNameHashtable;
+};
+
 class Row final : public mozIStorageRow
 {
 public:
@@ -30,8 +63,11 @@ public:
    *
    * @param aStatement
    *        The sqlite statement to pull results from.
+   * @param aColumnNames
+   *        The column names of aStatement, shared with the other rows it
+   *        returns.
    */
-  nsresult initialize(sqlite3_stmt *aStatement);
+  nsresult initialize(sqlite3_stmt *aStatement, RowColumnNames *aColumnNames);
 
 private:
   ~Row() {}
@@ -49,7 +85,7 @@ private:
   /**
    * Maps a given name to a column index.
    */
-  nsDataHashtable<nsCStringHashKey, uint32_t> mNameHashtable;
+  nsRefPtr<RowColumnNames> mColumnNames;
 };
 
 } // namespace storage
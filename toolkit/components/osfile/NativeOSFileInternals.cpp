@@ -665,6 +665,13 @@ public:
       return NS_ERROR_FAILURE;
     }
 
+#if defined(HAVE_POSIX_FADVISE)
+    // The whole file is read front to back, as with FILE_FLAG_SEQUENTIAL_SCAN
+    // on Windows, so let the kernel read ahead aggressively.
+    posix_fadvise(PR_FileDesc2NativeHandle(file), 0, 0,
+                  POSIX_FADV_SEQUENTIAL);
+#endif
+
 #endif // defined(XP_XIN)
 
     PRFileInfo64 stat;
@@ -951,7 +951,18 @@ public:
 
       FetchReferrerInfo(referrer, place);
 
-      nsresult rv = DoDatabaseInserts(known, place, referrer);
+      // Frecency is calculated from all of a page's visits, so when the next
+      // visit is to the same page and will update frecency and visibility
+      // itself, there's no need to calculate it for this one as well.
+      bool deferFrecency = false;
+      if (i + 1 < mPlaces.Length()) {
+        const VisitData& next = mPlaces[i + 1];
+        deferFrecency = next.spec.Equals(place.spec) &&
+                        next.shouldUpdateFrecency &&
+                        (place.hidden || !next.hidden);
+      }
+
+      nsresult rv = DoDatabaseInserts(known, place, referrer, !deferFrecency);
       if (!!mCallback) {
         nsCOMPtr<nsIRunnable> event =
           new NotifyPlaceInfoCallback(mCallback, place, true, rv);
@@ -1013,10 +1024,13 @@ private:
    *        The place we are adding a visit for.
    * @param aReferrer
    *        The referrer for aPlace.
+   * @param aUpdateFrecency
+   *        False if a later visit in this batch will update aPlace's frecency.
    */
   nsresult DoDatabaseInserts(bool aKnown,
                              VisitData& aPlace,
-                             VisitData& aReferrer)
+                             VisitData& aReferrer,
+                             bool aUpdateFrecency)
   {
     MOZ_ASSERT(!NS_IsMainThread(), "This should not be called on the main thread");
 
@@ -1048,11 +1062,8 @@ private:
     rv = AddVisit(aPlace, aReferrer);
     NS_ENSURE_SUCCESS(rv, rv);
 
-    // TODO (bug 623969) we shouldn't update this after each visit, but
-    // rather only for each unique place to save disk I/O.
-
     // Don't update frecency if the page should not appear in autocomplete.
-    if (aPlace.shouldUpdateFrecency) {
+    if (aPlace.shouldUpdateFrecency && aUpdateFrecency) {
       rv = UpdateFrecency(aPlace);
       NS_ENSURE_SUCCESS(rv, rv);
     }
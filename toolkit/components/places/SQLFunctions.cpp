@@ -386,9 +386,18 @@ namespace places {
     // Obtain our search function.
     searchFunctionPtr searchFunction = getSearchFunction(matchBehavior);
 
-    // Clean up our URI spec and prepare it for searching.
+    // Cleaning up the URI spec unescapes and copies it, so only do it once a
+    // token actually has to be searched for in the URL.  This function runs
+    // for every row of the history scan.
     nsCString fixedURI;
-    fixupURISpec(url, matchBehavior, fixedURI);
+    bool fixedURIReady = false;
+    auto urlMatches = [&](const nsDependentCSubstring &aToken) {
+      if (!fixedURIReady) {
+        fixupURISpec(url, matchBehavior, fixedURI);
+        fixedURIReady = true;
+      }
+      return searchFunction(aToken, fixedURI);
+    };
 
     nsAutoCString title;
     (void)aArguments->GetUTF8String(kArgIndexTitle, title);
@@ -401,18 +410,18 @@ namespace places {
 
       if (HAS_BEHAVIOR(TITLE) && HAS_BEHAVIOR(URL)) {
         matches = (searchFunction(token, title) || searchFunction(token, tags)) &&
-                  searchFunction(token, fixedURI);
+                  urlMatches(token);
       }
       else if (HAS_BEHAVIOR(TITLE)) {
         matches = searchFunction(token, title) || searchFunction(token, tags);
       }
       else if (HAS_BEHAVIOR(URL)) {
-        matches = searchFunction(token, fixedURI);
+        matches = urlMatches(token);
       }
       else {
         matches = searchFunction(token, title) ||
                   searchFunction(token, tags) ||
-                  searchFunction(token, fixedURI);
+                  urlMatches(token);
       }
     }
 
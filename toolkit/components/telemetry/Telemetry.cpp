@@ -1066,11 +1066,9 @@ CloneHistogram(const nsACString& newName, Telemetry::ID existingId)
 
 #if !defined(MOZ_WIDGET_GONK) && !defined(MOZ_WIDGET_ANDROID)
 Histogram*
-GetSubsessionHistogram(Histogram& existing)
+GetSubsessionHistogram(Telemetry::ID id, Histogram& existing)
 {
-  Telemetry::ID id;
-  nsresult rv = TelemetryImpl::GetHistogramEnumId(existing.histogram_name().c_str(), &id);
-  if (NS_FAILED(rv) || gHistograms[id].keyed) {
+  if (gHistograms[id].keyed) {
     return nullptr;
   }
 
@@ -1091,10 +1089,27 @@ GetSubsessionHistogram(Histogram& existing)
   subsession[id] = CloneHistogram(subsessionName, id, existing);
   return subsession[id];
 }
+
+Histogram*
+GetSubsessionHistogram(Histogram& existing)
+{
+  Telemetry::ID id;
+  nsresult rv = TelemetryImpl::GetHistogramEnumId(existing.histogram_name().c_str(), &id);
+  if (NS_FAILED(rv)) {
+    return nullptr;
+  }
+
+  return GetSubsessionHistogram(id, existing);
+}
 #endif
 
+// Adds |value| to |histogram| and to its subsession histogram. |id| is the
+// histogram's ID if the caller knows it, e.g. Telemetry::Accumulate, which
+// avoids looking the histogram up by name in mHistogramMap on every sample.
+// Otherwise it is HistogramCount.
 nsresult
-HistogramAdd(Histogram& histogram, int32_t value, uint32_t dataset)
+HistogramAdd(Histogram& histogram, int32_t value, uint32_t dataset,
+             Telemetry::ID id)
 {
   // Check if we are allowed to record the data.
   if (!CanRecordDataset(dataset)) {
@@ -1102,7 +1117,10 @@ HistogramAdd(Histogram& histogram, int32_t value, uint32_t dataset)
   }
 
 #if !defined(MOZ_WIDGET_GONK) && !defined(MOZ_WIDGET_ANDROID)
-  if (Histogram* subsession = GetSubsessionHistogram(histogram)) {
+  Histogram* subsession = id == Telemetry::HistogramCount
+                          ? GetSubsessionHistogram(histogram)
+                          : GetSubsessionHistogram(id, histogram);
+  if (subsession) {
     subsession->Add(value);
   }
 #endif
@@ -1114,6 +1132,18 @@ HistogramAdd(Histogram& histogram, int32_t value, uint32_t dataset)
   return NS_OK;
 }
 
+nsresult
+HistogramAdd(Histogram& histogram, int32_t value, uint32_t dataset)
+{
+  return HistogramAdd(histogram, value, dataset, Telemetry::HistogramCount);
+}
+
+nsresult
+HistogramAdd(Telemetry::ID id, Histogram& histogram, int32_t value)
+{
+  return HistogramAdd(histogram, value, gHistograms[id].dataset, id);
+}
+
 nsresult
 HistogramAdd(Histogram& histogram, int32_t value)
 {
@@ -3716,7 +3746,7 @@ Accumulate(ID aHistogram, uint32_t aSample)
   Histogram *h;
   nsresult rv = GetHistogramByEnumId(aHistogram, &h);
   if (NS_SUCCEEDED(rv)) {
-    HistogramAdd(*h, aSample, gHistograms[aHistogram].dataset);
+    HistogramAdd(aHistogram, *h, aSample);
   }
 }
 
@@ -3747,7 +3777,7 @@ Accumulate(const char* name, uint32_t sample)
   Histogram *h;
   rv = GetHistogramByEnumId(id, &h);
   if (NS_SUCCEEDED(rv)) {
-    HistogramAdd(*h, sample, gHistograms[id].dataset);
+    HistogramAdd(id, *h, sample);
   }
 }
 
@@ -319,18 +319,27 @@ nsUrlClassifierPrefixSet::LoadFromFd(AutoFDClose& fileFd)
     if (indexSize != 0 && indexStarts[0] != 0) {
       return NS_ERROR_FILE_CORRUPTED;
     }
+
+    // The deltas for all the chunks are stored back to back, so pull them in
+    // with a single read rather than issuing one per chunk.
+    nsTArray<uint16_t> deltas;
+    deltas.SetLength(deltaSize);
+    toRead = deltaSize * sizeof(uint16_t);
+    read = PR_Read(fileFd, deltas.Elements(), toRead);
+    NS_ENSURE_TRUE(read == toRead, NS_ERROR_FILE_CORRUPTED);
+
     for (uint32_t i = 0; i < indexSize; i++) {
       uint32_t numInDelta = i == indexSize - 1 ? deltaSize - indexStarts[i]
                                : indexStarts[i + 1] - indexStarts[i];
-      if (numInDelta > DELTAS_LIMIT) {
+      if (numInDelta > DELTAS_LIMIT ||
+          indexStarts[i] > deltaSize ||
+          numInDelta > deltaSize - indexStarts[i]) {
         return NS_ERROR_FILE_CORRUPTED;
       }
       if (numInDelta > 0) {
-        mIndexDeltas[i].SetLength(numInDelta);
+        mIndexDeltas[i].AppendElements(deltas.Elements() + indexStarts[i],
+                                       numInDelta);
         mTotalPrefixes += numInDelta;
-        toRead = numInDelta * sizeof(uint16_t);
-        read = PR_Read(fileFd, mIndexDeltas[i].Elements(), toRead);
-        NS_ENSURE_TRUE(read == toRead, NS_ERROR_FILE_CORRUPTED);
       }
     }
   } else {
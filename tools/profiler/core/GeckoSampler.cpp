@@ -202,6 +202,7 @@ GeckoSampler::GeckoSampler(double aInterval, int aEntrySize,
   mPrivacyMode = hasFeature(aFeatures, aFeatureCount, "privacy");
   mAddMainThreadIO = hasFeature(aFeatures, aFeatureCount, "mainthreadio");
   mProfileMemory = hasFeature(aFeatures, aFeatureCount, "memory");
+  mProfileHWCounters = hasFeature(aFeatures, aFeatureCount, "hwcounters");
   mTaskTracer = hasFeature(aFeatures, aFeatureCount, "tasktracer");
   mLayersDump = hasFeature(aFeatures, aFeatureCount, "layersdump");
   mDisplayListDump = hasFeature(aFeatures, aFeatureCount, "displaylistdump");
@@ -393,6 +394,9 @@ JSObject* GeckoSampler::ToJSObject(JSContext *aCx, double aSinceTime)
   {
     UniquePtr<char[]> buf = ToJSON(aSinceTime);
     NS_ConvertUTF8toUTF16 js_string(nsDependentCString(buf.get()));
+    // Profiles can be hundreds of MB; don't hold the UTF-8 copy while the
+    // parser builds the JS object.
+    buf = nullptr;
     MOZ_ALWAYS_TRUE(JS_ParseJSON(aCx, static_cast<const char16_t*>(js_string.get()),
                                  js_string.Length(), &val));
   }
@@ -1222,6 +1226,13 @@ void GeckoSampler::InplaceTick(TickSample* sample)
     currThreadProfile.addTag(ProfileEntry('U', static_cast<double>(sample->ussMemory)));
   }
 
+  // instructions is equal to 0 when we are not recording hardware counters.
+  if (sample && sample->instructions != 0) {
+    currThreadProfile.addTag(ProfileEntry('i', static_cast<double>(sample->instructions)));
+    currThreadProfile.addTag(ProfileEntry('M', static_cast<double>(sample->cacheMisses)));
+    currThreadProfile.addTag(ProfileEntry('b', static_cast<double>(sample->branchMisses)));
+  }
+
 #if defined(XP_WIN)
   if (mProfilePower) {
     mIntelPowerGadget->TakeSample();
@@ -545,12 +545,16 @@ struct ProfileSample
   Maybe<double> mUSS;
   Maybe<int> mFrameNumber;
   Maybe<double> mPower;
+  Maybe<double> mInstructions;
+  Maybe<double> mCacheMisses;
+  Maybe<double> mBranchMisses;
 };
 
 static void WriteSample(SpliceableJSONWriter& aWriter, ProfileSample& aSample)
 {
   // Schema:
-  //   [stack, time, responsiveness, rss, uss, frameNumber, power]
+  //   [stack, time, responsiveness, rss, uss, frameNumber, power,
+  //    instructions, cacheMisses, branchMisses]
 
   aWriter.StartArrayElement();
   {
@@ -603,6 +607,27 @@ static void WriteSample(SpliceableJSONWriter& aWriter, ProfileSample& aSample)
       aWriter.DoubleElement(*aSample.mPower);
     }
     index++;
+
+    if (aSample.mInstructions.isSome()) {
+      aWriter.NullElements(index - lastNonNullIndex - 1);
+      lastNonNullIndex = index;
+      aWriter.DoubleElement(*aSample.mInstructions);
+    }
+    index++;
+
+    if (aSample.mCacheMisses.isSome()) {
+      aWriter.NullElements(index - lastNonNullIndex - 1);
+      lastNonNullIndex = index;
+      aWriter.DoubleElement(*aSample.mCacheMisses);
+    }
+    index++;
+
+    if (aSample.mBranchMisses.isSome()) {
+      aWriter.NullElements(index - lastNonNullIndex - 1);
+      lastNonNullIndex = index;
+      aWriter.DoubleElement(*aSample.mBranchMisses);
+    }
+    index++;
   }
   aWriter.EndArray();
 }
@@ -657,6 +682,21 @@ void ProfileBuffer::StreamSamplesToJSON(SpliceableJSONWriter& aWriter, int aThre
           sample->mFrameNumber = Some(entry.mTagInt);
         }
         break;
+      case 'i':
+        if (sample.isSome()) {
+          sample->mInstructions = Some(entry.mTagDouble);
+        }
+        break;
+      case 'M':
+        if (sample.isSome()) {
+          sample->mCacheMisses = Some(entry.mTagDouble);
+        }
+        break;
+      case 'b':
+        if (sample.isSome()) {
+          sample->mBranchMisses = Some(entry.mTagDouble);
+        }
+        break;
       case 's':
         {
           // end the previous sample if there was one
@@ -812,6 +852,11 @@ void ProfileBuffer::DuplicateLastSample(int aThreadId)
       case 'm':
         // Don't copy markers
         break;
+      case 'i':
+      case 'M':
+      case 'b':
+        // Don't copy hardware counter deltas; a sleeping thread didn't run.
+        break;
       // Copy anything else we don't know about
       // L, B, S, c, s, d, l, f, h, r, t, p
       default:
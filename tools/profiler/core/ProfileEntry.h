@@ -341,7 +341,10 @@ private:
 //       "rss": 3,             /* number */
 //       "uss": 4,             /* number */
 //       "frameNumber": 5,     /* number */
-//       "power": 6            /* number */
+//       "power": 6,           /* number */
+//       "instructions": 7,    /* number */
+//       "cacheMisses": 8,     /* number */
+//       "branchMisses": 9     /* number */
 //     },
 //     "data":
 //     [
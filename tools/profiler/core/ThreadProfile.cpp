@@ -19,6 +19,13 @@ ThreadProfile::ThreadProfile(ThreadInfo* aInfo, ProfileBuffer* aBuffer)
 #ifdef XP_LINUX
   , mRssMemory(0)
   , mUssMemory(0)
+  , mHWCountersValid(false)
+  , mLastInstructions(0)
+  , mLastCacheMisses(0)
+  , mLastBranchMisses(0)
+  , mInstructions(0)
+  , mCacheMisses(0)
+  , mBranchMisses(0)
 #endif
 {
   MOZ_COUNT_CTOR(ThreadProfile);
@@ -136,6 +143,9 @@ void ThreadProfile::StreamSamplesAndMarkers(SpliceableJSONWriter& aWriter, doubl
       schema.WriteField("uss");
       schema.WriteField("frameNumber");
       schema.WriteField("power");
+      schema.WriteField("instructions");
+      schema.WriteField("cacheMisses");
+      schema.WriteField("branchMisses");
     }
 
     aWriter.StartArrayProperty("data");
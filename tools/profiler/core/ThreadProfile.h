@@ -98,6 +98,16 @@ private:
 public:
   int64_t        mRssMemory;
   int64_t        mUssMemory;
+
+  // Hardware counter values at the previous sample, and the deltas since
+  // then which are handed to the signal handler.
+  bool           mHWCountersValid;
+  uint64_t       mLastInstructions;
+  uint64_t       mLastCacheMisses;
+  uint64_t       mLastBranchMisses;
+  int64_t        mInstructions;
+  int64_t        mCacheMisses;
+  int64_t        mBranchMisses;
 #endif
 };
 
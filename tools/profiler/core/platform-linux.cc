@@ -92,6 +92,11 @@
 #include <string.h>
 #include <list>
 
+#if defined(SPS_OS_linux)
+// Hardware counter profile
+#include <linux/perf_event.h>
+#endif
+
 #ifdef MOZ_NUWA_PROCESS
 #include "ipc/Nuwa.h"
 #endif
@@ -248,6 +253,9 @@ void ProfilerSignalHandler(int signal, siginfo_t* info, void* context) {
   sample->timestamp = mozilla::TimeStamp::Now();
   sample->rssMemory = sample->threadProfile->mRssMemory;
   sample->ussMemory = sample->threadProfile->mUssMemory;
+  sample->instructions = sample->threadProfile->mInstructions;
+  sample->cacheMisses = sample->threadProfile->mCacheMisses;
+  sample->branchMisses = sample->threadProfile->mBranchMisses;
 
   Sampler::GetActiveSampler()->Tick(sample);
 
@@ -257,6 +265,102 @@ void ProfilerSignalHandler(int signal, siginfo_t* info, void* context) {
 
 } // namespace
 
+int tgkill(pid_t tgid, pid_t tid, int signalno) {
+  return syscall(SYS_tgkill, tgid, tid, signalno);
+}
+
+class PlatformData {
+ public:
+  explicit PlatformData(int aThreadId)
+    : mThreadId(aThreadId)
+    , mHWCountersOpened(false)
+  {
+    for (size_t i = 0; i < kHWCounterCount; i++) {
+      mHWCounterFds[i] = -1;
+    }
+  }
+
+  ~PlatformData()
+  {
+    for (size_t i = 0; i < kHWCounterCount; i++) {
+      if (mHWCounterFds[i] != -1) {
+        close(mHWCounterFds[i]);
+      }
+    }
+  }
+
+  // Reads the thread's instructions retired, cache misses and branch misses
+  // counters. The counters are opened on first use, from the sampler thread.
+  bool ReadHWCounters(uint64_t* aInstructions, uint64_t* aCacheMisses,
+                      uint64_t* aBranchMisses)
+  {
+#if defined(SPS_OS_linux) && defined(__NR_perf_event_open)
+    if (!mHWCountersOpened) {
+      mHWCountersOpened = true;
+      OpenHWCounters();
+    }
+    if (mHWCounterFds[kHWCounterCount - 1] == -1) {
+      return false;
+    }
+
+    // With PERF_FORMAT_GROUP, reading the group leader returns the number
+    // of counters followed by their values, all sampled at once.
+    struct {
+      uint64_t nr;
+      uint64_t values[kHWCounterCount];
+    } data;
+    if (read(mHWCounterFds[0], &data, sizeof(data)) != sizeof(data) ||
+        data.nr != kHWCounterCount) {
+      return false;
+    }
+    *aInstructions = data.values[0];
+    *aCacheMisses = data.values[1];
+    *aBranchMisses = data.values[2];
+    return true;
+#else
+    return false;
+#endif
+  }
+
+ private:
+#if defined(SPS_OS_linux) && defined(__NR_perf_event_open)
+  void OpenHWCounters()
+  {
+    static const uint64_t kConfigs[kHWCounterCount] = {
+      PERF_COUNT_HW_INSTRUCTIONS,
+      PERF_COUNT_HW_CACHE_MISSES,
+      PERF_COUNT_HW_BRANCH_MISSES
+    };
+
+    for (size_t i = 0; i < kHWCounterCount; i++) {
+      struct perf_event_attr attr;
+      memset(&attr, 0, sizeof(attr));
+      attr.size = sizeof(attr);
+      attr.type = PERF_TYPE_HARDWARE;
+      attr.config = kConfigs[i];
+      attr.read_format = PERF_FORMAT_GROUP;
+      attr.exclude_kernel = 1;
+      attr.exclude_hv = 1;
+      int groupFd = i == 0 ? -1 : mHWCounterFds[0];
+      mHWCounterFds[i] = syscall(__NR_perf_event_open, &attr, mThreadId,
+                                 /* cpu */ -1, groupFd, /* flags */ 0);
+      if (mHWCounterFds[i] == -1) {
+        // Not supported by the hardware, or forbidden by
+        // perf_event_paranoid. Don't try again for this thread.
+        LOG("profiler failed to open hardware counters");
+        return;
+      }
+    }
+  }
+#endif
+
+  static const size_t kHWCounterCount = 3;
+
+  int mThreadId;
+  bool mHWCountersOpened;
+  int mHWCounterFds[kHWCounterCount];
+};
+
 static void ProfilerSignalThread(ThreadProfile *profile,
                                  bool isFirstProfiledThread)
 {
@@ -267,22 +371,32 @@ static void ProfilerSignalThread(ThreadProfile *profile,
     profile->mRssMemory = 0;
     profile->mUssMemory = 0;
   }
-}
 
-int tgkill(pid_t tgid, pid_t tid, int signalno) {
-  return syscall(SYS_tgkill, tgid, tid, signalno);
+  uint64_t instructions, cacheMisses, branchMisses;
+  if (Sampler::GetActiveSampler()->ProfileHWCounters() &&
+      profile->GetPlatformData() &&
+      profile->GetPlatformData()->ReadHWCounters(&instructions, &cacheMisses,
+                                                 &branchMisses)) {
+    if (profile->mHWCountersValid) {
+      profile->mInstructions = instructions - profile->mLastInstructions;
+      profile->mCacheMisses = cacheMisses - profile->mLastCacheMisses;
+      profile->mBranchMisses = branchMisses - profile->mLastBranchMisses;
+    }
+    profile->mHWCountersValid = true;
+    profile->mLastInstructions = instructions;
+    profile->mLastCacheMisses = cacheMisses;
+    profile->mLastBranchMisses = branchMisses;
+  } else {
+    profile->mInstructions = 0;
+    profile->mCacheMisses = 0;
+    profile->mBranchMisses = 0;
+  }
 }
 
-class PlatformData {
- public:
-  PlatformData()
-  {}
-};
-
 /* static */ PlatformData*
 Sampler::AllocPlatformData(int aThreadId)
 {
-  return new PlatformData;
+  return new PlatformData(aThreadId);
 }
 
 /* static */ void
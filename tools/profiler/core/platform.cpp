@@ -648,6 +648,11 @@ const char** mozilla_sampler_get_features()
 #if defined(XP_WIN)
     // Add power collection
     "power",
+#endif
+#if defined(SPS_OS_linux)
+    // Add hardware performance counter (instructions, cache and branch
+    // misses) collection
+    "hwcounters",
 #endif
     nullptr
   };
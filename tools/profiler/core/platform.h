@@ -292,7 +292,10 @@ class TickSample {
         isSamplingCurrentThread(false),
         threadProfile(nullptr),
         rssMemory(0),
-        ussMemory(0) {}
+        ussMemory(0),
+        instructions(0),
+        cacheMisses(0),
+        branchMisses(0) {}
 
   void PopulateContext(void* aContext);
 
@@ -309,6 +312,10 @@ class TickSample {
   mozilla::TimeStamp timestamp;
   int64_t rssMemory;
   int64_t ussMemory;
+  // Hardware counter deltas since the thread's previous sample.
+  int64_t instructions;
+  int64_t cacheMisses;
+  int64_t branchMisses;
 };
 
 class ThreadInfo;
@@ -87,6 +87,9 @@ ProfileGatherer::Finish()
   JS::RootedValue val(cx);
   {
     NS_ConvertUTF8toUTF16 js_string(nsDependentCString(buf.get()));
+    // Profiles can be hundreds of MB; don't hold the UTF-8 copy while the
+    // parser builds the JS object.
+    buf = nullptr;
     if (!JS_ParseJSON(cx, static_cast<const char16_t*>(js_string.get()),
                       js_string.Length(), &val)) {
       if (!jsapi.HasException()) {
@@ -2423,6 +2423,19 @@ nsWindow::OnLeaveNotifyEvent(GdkEventCrossing *aEvent)
 void
 nsWindow::OnMotionNotifyEvent(GdkEventMotion *aEvent)
 {
+    // If GDK has already queued another motion event for this window, this
+    // one is stale: drop it and let the queued event, which GDK dispatches
+    // next, carry the latest position.  Button and key events are never
+    // dropped, so only consecutive moves are coalesced.
+    GdkEvent *peekedEvent = gdk_event_peek();
+    if (peekedEvent) {
+        bool isStale = peekedEvent->any.type == GDK_MOTION_NOTIFY &&
+                       peekedEvent->any.window == aEvent->window;
+        gdk_event_free(peekedEvent);
+        if (isStale)
+            return;
+    }
+
     // see if we can compress this event
     // XXXldb Why skip every other motion event when we have multiple,
     // but not more than that?
@@ -1216,6 +1216,7 @@ enum ccPhase
 {
   IdlePhase,
   GraphBuildingPhase,
+  ScanRootsPhase,
   ScanAndCollectWhitePhase,
   CleanupPhase
 };
@@ -1264,6 +1265,11 @@ class nsCycleCollector : public nsIMemoryReporter
 
   uint32_t mWhiteNodeCount;
 
+  // State for ScanRoots(), which can be spread over several slices.
+  nsAutoPtr<NodePool::Enumerator> mScanNode;
+  bool mScanningBlackNodes;
+  uint32_t mScanStartSlice;
+
   CC_BeforeUnlinkCallback mBeforeUnlinkCB;
   CC_ForgetSkippableCallback mForgetSkippableCB;
 
@@ -1332,10 +1338,11 @@ private:
 
   void BeginCollection(ccType aCCType, nsICycleCollectorListener* aManualListener);
   void MarkRoots(SliceBudget& aBudget);
-  void ScanRoots(bool aFullySynchGraphBuild);
+  void ScanRoots(SliceBudget& aBudget, bool aFullySynchGraphBuild);
+  void FinishScanRoots();
   void ScanIncrementalRoots();
-  void ScanWhiteNodes(bool aFullySynchGraphBuild);
-  void ScanBlackNodes();
+  bool ScanWhiteNodes(SliceBudget& aBudget, bool aFullySynchGraphBuild);
+  bool ScanBlackNodes(SliceBudget& aBudget);
   void ScanWeakMaps();
 
   // returns whether anything was collected
@@ -2848,7 +2855,7 @@ nsCycleCollector::MarkRoots(SliceBudget& aBudget)
   }
 
   mBuilder = nullptr;
-  mIncrementalPhase = ScanAndCollectWhitePhase;
+  mIncrementalPhase = ScanRootsPhase;
   timeLog.Checkpoint("MarkRoots()");
 }
 
@@ -3084,12 +3091,21 @@ nsCycleCollector::ScanIncrementalRoots()
 // Mark nodes white and make sure their refcounts are ok.
 // No nodes are marked black during this pass to ensure that refcount
 // checking is run on all nodes not marked black by ScanIncrementalRoots.
-void
-nsCycleCollector::ScanWhiteNodes(bool aFullySynchGraphBuild)
+// Returns false if the budget ran out before all nodes were scanned.
+bool
+nsCycleCollector::ScanWhiteNodes(SliceBudget& aBudget,
+                                 bool aFullySynchGraphBuild)
 {
-  NodePool::Enumerator nodeEnum(mGraph.mNodes);
-  while (!nodeEnum.IsDone()) {
-    PtrInfo* pi = nodeEnum.GetNext();
+  const intptr_t kNumNodesBetweenTimeChecks = 1000;
+  const intptr_t kStep = SliceBudget::CounterReset / kNumNodesBetweenTimeChecks;
+
+  while (!mScanNode->IsDone()) {
+    if (aBudget.isOverBudget()) {
+      return false;
+    }
+    aBudget.step(kStep);
+
+    PtrInfo* pi = mScanNode->GetNext();
     if (pi->mColor == black) {
       // Incremental roots can be in a nonsensical state, so don't
       // check them. This will miss checking nodes that are merely
@@ -3118,19 +3134,30 @@ nsCycleCollector::ScanWhiteNodes(bool aFullySynchGraphBuild)
 
     // This node will get marked black in the next pass.
   }
+  return true;
 }
 
 // Any remaining grey nodes that haven't already been deleted must be alive,
 // so mark them and their children black. Any nodes that are black must have
 // already had their children marked black, so there's no need to look at them
-// again. This pass may turn some white nodes to black.
-void
-nsCycleCollector::ScanBlackNodes()
+// again. This pass may turn some white nodes to black. Returns false if the
+// budget ran out before all nodes were scanned.
+bool
+nsCycleCollector::ScanBlackNodes(SliceBudget& aBudget)
 {
+  const intptr_t kNumNodesBetweenTimeChecks = 1000;
+  const intptr_t kStep = SliceBudget::CounterReset / kNumNodesBetweenTimeChecks;
+
   bool failed = false;
-  NodePool::Enumerator nodeEnum(mGraph.mNodes);
-  while (!nodeEnum.IsDone()) {
-    PtrInfo* pi = nodeEnum.GetNext();
+  bool done = true;
+  while (!mScanNode->IsDone()) {
+    if (aBudget.isOverBudget()) {
+      done = false;
+      break;
+    }
+    aBudget.step(kStep);
+
+    PtrInfo* pi = mScanNode->GetNext();
     if (pi->mColor == grey && pi->WasTraversed()) {
       FloodBlackNode(mWhiteNodeCount, failed, pi);
     }
@@ -3140,27 +3167,72 @@ nsCycleCollector::ScanBlackNodes()
     NS_ASSERTION(false, "Ran out of memory in ScanBlackNodes");
     CC_TELEMETRY(_OOM, true);
   }
+  return done;
+}
+
+// The white and black passes only look at the graph, not at the objects in
+// it, so they can be spread across several slices. Anything the mutator does
+// in between is picked up by the second ScanIncrementalRoots() call in
+// FinishScanRoots(), just like mutations during graph building are.
+void
+nsCycleCollector::ScanRoots(SliceBudget& aBudget, bool aFullySynchGraphBuild)
+{
+  AutoRestore<bool> ar(mScanInProgress);
+  MOZ_ASSERT(!mScanInProgress);
+  mScanInProgress = true;
+  MOZ_ASSERT(mIncrementalPhase == ScanRootsPhase);
+
+  // A listener wants each incremental root reported exactly once, so don't
+  // split the scan when there is one.
+  SliceBudget unlimitedBudget;
+  SliceBudget& budget = mLogger ? unlimitedBudget : aBudget;
+
+  TimeLog timeLog;
+  if (!mScanNode) {
+    mWhiteNodeCount = 0;
+    mScanStartSlice = mResults.mNumSlices;
+    if (!aFullySynchGraphBuild) {
+      ScanIncrementalRoots();
+    }
+    mScanNode = new NodePool::Enumerator(mGraph.mNodes);
+  }
+
+  if (!mScanningBlackNodes) {
+    bool done = ScanWhiteNodes(budget, aFullySynchGraphBuild);
+    timeLog.Checkpoint("ScanRoots::ScanWhiteNodes");
+    if (!done) {
+      return;
+    }
+    mScanNode = new NodePool::Enumerator(mGraph.mNodes);
+    mScanningBlackNodes = true;
+  }
+
+  bool done = ScanBlackNodes(budget);
+  timeLog.Checkpoint("ScanRoots::ScanBlackNodes");
+  if (!done) {
+    return;
+  }
+
+  mScanNode = nullptr;
+  mScanningBlackNodes = false;
+  mIncrementalPhase = ScanAndCollectWhitePhase;
 }
 
 void
-nsCycleCollector::ScanRoots(bool aFullySynchGraphBuild)
+nsCycleCollector::FinishScanRoots()
 {
   AutoRestore<bool> ar(mScanInProgress);
   MOZ_ASSERT(!mScanInProgress);
   mScanInProgress = true;
-  mWhiteNodeCount = 0;
   MOZ_ASSERT(mIncrementalPhase == ScanAndCollectWhitePhase);
 
-  if (!aFullySynchGraphBuild) {
+  // If ScanRoots() was spread over several slices, objects may have been
+  // stored somewhere since it looked at the incremental roots.
+  if (mScanStartSlice != mResults.mNumSlices) {
     ScanIncrementalRoots();
   }
 
   TimeLog timeLog;
-  ScanWhiteNodes(aFullySynchGraphBuild);
-  timeLog.Checkpoint("ScanRoots::ScanWhiteNodes");
-
-  ScanBlackNodes();
-  timeLog.Checkpoint("ScanRoots::ScanBlackNodes");
 
   // Scanning weak maps must be done last.
   ScanWeakMaps();
@@ -3194,7 +3266,7 @@ nsCycleCollector::ScanRoots(bool aFullySynchGraphBuild)
 
     mLogger->End();
     mLogger = nullptr;
-    timeLog.Checkpoint("ScanRoots::listener");
+    timeLog.Checkpoint("FinishScanRoots::listener");
   }
 }
 
@@ -3367,6 +3439,8 @@ nsCycleCollector::nsCycleCollector() :
   mIncrementalPhase(IdlePhase),
   mThread(NS_GetCurrentThread()),
   mWhiteNodeCount(0),
+  mScanningBlackNodes(false),
+  mScanStartSlice(0),
   mBeforeUnlinkCB(nullptr),
   mForgetSkippableCB(nullptr),
   mUnmergedNeeded(0),
@@ -3620,13 +3694,23 @@ nsCycleCollector::Collect(ccType aCCType,
         continueSlice = aBudget.isUnlimited() ||
           (mResults.mNumSlices < 3 && !aPreferShorterSlices);
         break;
+      case ScanRootsPhase:
+        PrintPhase("ScanRoots");
+        ScanRoots(aBudget, startedIdle);
+        if (mIncrementalPhase != ScanAndCollectWhitePhase) {
+          break;
+        }
+        // The scan is complete. Finish it and collect white objects in this
+        // same slice, so that the mutator can't run in between and a listener
+        // sees each incremental root only once.
+        // Fall through
       case ScanAndCollectWhitePhase:
-        // We do ScanRoots and CollectWhite in a single slice to ensure
+        // We do FinishScanRoots and CollectWhite in a single slice to ensure
         // that we won't unlink a live object if a weak reference is
-        // promoted to a strong reference after ScanRoots has finished.
+        // promoted to a strong reference after the scan has finished.
         // See bug 926533.
-        PrintPhase("ScanRoots");
-        ScanRoots(startedIdle);
+        PrintPhase("FinishScanRoots");
+        FinishScanRoots();
         PrintPhase("CollectWhite");
         collectedAny = CollectWhite();
         break;
@@ -2101,6 +2101,12 @@ nsMemoryReporterManager::GetGhostWindows(int64_t* aAmount)
   return GetInfallibleAmount(mAmountFns.mGhostWindows, aAmount);
 }
 
+NS_IMETHODIMP
+nsMemoryReporterManager::GetGfxTextures(int64_t* aAmount)
+{
+  return GetInfallibleAmount(mAmountFns.mGfxTextures, aAmount);
+}
+
 NS_IMETHODIMP
 nsMemoryReporterManager::GetPageFaultsHard(int64_t* aAmount)
 {
@@ -2346,6 +2352,8 @@ DEFINE_REGISTER_DISTINGUISHED_AMOUNT(Infallible, LowMemoryEventsPhysical)
 
 DEFINE_REGISTER_DISTINGUISHED_AMOUNT(Infallible, GhostWindows)
 
+DEFINE_REGISTER_DISTINGUISHED_AMOUNT(Infallible, GfxTextures)
+
 #undef DEFINE_REGISTER_DISTINGUISHED_AMOUNT
 #undef DEFINE_UNREGISTER_DISTINGUISHED_AMOUNT
 
@@ -151,6 +151,8 @@ public:
 
     mozilla::InfallibleAmountFn mGhostWindows;
 
+    mozilla::InfallibleAmountFn mGfxTextures;
+
     AmountFns()
     {
       mozilla::PodZero(this);
@@ -600,7 +600,12 @@ nsComponentManagerImpl::RegisterContractIDLocked(
     return;
   }
 
-  mContractIDs.Put(nsDependentCString(aEntry->contractid), f);
+  // Module contract IDs live in static storage for as long as the module is
+  // loaded, which outlasts mContractIDs, so the key can share the buffer
+  // instead of copying it.
+  nsCString contractID;
+  contractID.AssignLiteral(aEntry->contractid, strlen(aEntry->contractid));
+  mContractIDs.Put(contractID, f);
 }
 
 #if !defined(MOZILLA_XPCOMRT_API)
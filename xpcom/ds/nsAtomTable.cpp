@@ -10,6 +10,7 @@
 #include "mozilla/HashFunctions.h"
 #include "mozilla/MemoryReporting.h"
 #include "mozilla/DebugOnly.h"
+#include "mozilla/StaticMutex.h"
 #include "mozilla/unused.h"
 
 #include "nsAtomTable.h"
@@ -37,11 +38,11 @@ using namespace mozilla;
 /**
  * The shared hash table for atom lookups.
  *
- * XXX This should be manipulated in a threadsafe way or we should make
- * sure it's only manipulated from the main thread.  Probably the latter
- * is better, since the former would hurt performance.
+ * gAtomTable may be used from any thread, so every access to it (including
+ * the removal done when a dynamic atom dies) must hold gAtomTableLock.
  */
 static PLDHashTable* gAtomTable;
+static StaticMutex gAtomTableLock;
 
 class StaticAtomEntry : public PLDHashEntryHdr
 {
@@ -66,9 +67,9 @@ public:
 
   enum { ALLOW_MEMMOVE = true };
 
-  // mAtom only points to objects of type PermanentAtomImpl, which are not
-  // really refcounted.  But since these entries live in a global hashtable,
-  // this reference is essentially owning.
+  // mAtom only points to permanent atoms, which are not really refcounted.
+  // But since these entries live in a global hashtable, this reference is
+  // essentially owning.
   nsIAtom* MOZ_OWNING_REF mAtom;
 };
 
@@ -87,11 +88,16 @@ static bool gStaticAtomTableSealed = false;
 //----------------------------------------------------------------------
 
 /**
- * Note that AtomImpl objects are sometimes converted into PermanentAtomImpl
- * objects using placement new and just overwriting the vtable pointer.
+ * An atom is permanent when its refcount holds REFCNT_PERMANENT_SENTINEL.
+ * Permanent atoms ignore AddRef/Release and are owned by the atom table.
+ * A dynamic atom is made permanent in place, by storing the sentinel, when a
+ * static or permanent atom with the same string is registered.  Other threads
+ * may hold references to it at that point, so the refcount is only ever
+ * changed with compare-and-swap loops that give up once they see the
+ * sentinel.
  */
 
-class AtomImpl : public nsIAtom
+class AtomImpl final : public nsIAtom
 {
 public:
   AtomImpl(const nsAString& aString, uint32_t aHash);
@@ -100,77 +106,42 @@ public:
   // from NS_RegisterStaticAtoms
   AtomImpl(nsStringBuffer* aData, uint32_t aLength, uint32_t aHash);
 
-protected:
-  // This is only intended to be used when a normal atom is turned into a
-  // permanent one.
-  AtomImpl()
-  {
-    // We can't really assert that mString is a valid nsStringBuffer string,
-    // so do the best we can do and check for some consistencies.
-    NS_ASSERTION((mLength + 1) * sizeof(char16_t) <=
-                 nsStringBuffer::FromData(mString)->StorageSize() &&
-                 mString[mLength] == 0,
-                 "Not initialized atom");
-  }
-
-  // We don't need a virtual destructor here because PermanentAtomImpl
-  // deletions aren't handled through Release().
+private:
   ~AtomImpl();
 
 public:
-  NS_DECL_ISUPPORTS
+  NS_IMETHOD QueryInterface(REFNSIID aIID, void** aInstancePtr) override;
+  NS_IMETHOD_(MozExternalRefCountType) AddRef() override;
+  NS_IMETHOD_(MozExternalRefCountType) Release() override;
   NS_DECL_NSIATOM
 
   enum { REFCNT_PERMANENT_SENTINEL = UINT32_MAX };
 
-  virtual bool IsPermanent();
-
-  // We can't use the virtual function in the base class destructor.
-  bool IsPermanentInDestructor()
+  bool IsPermanent()
   {
     return mRefCnt == REFCNT_PERMANENT_SENTINEL;
   }
 
-  // for |#ifdef NS_BUILD_REFCNT_LOGGING| access to reference count
-  nsrefcnt GetRefCount() { return mRefCnt; }
+  // Makes this atom permanent.  The caller must hold gAtomTableLock.
+  void MakePermanent();
 
-  size_t SizeOfIncludingThis(MallocSizeOf aMallocSizeOf);
-};
-
-/**
- * A non-refcounted implementation of nsIAtom.
- */
-
-class PermanentAtomImpl final : public AtomImpl
-{
-public:
-  PermanentAtomImpl(const nsAString& aString, PLDHashNumber aKeyHash)
-    : AtomImpl(aString, aKeyHash)
+  // Deletes a permanent atom when the atom table is destroyed.
+  void DestroyPermanent()
   {
+    MOZ_ASSERT(IsPermanent());
+    delete this;
   }
-  PermanentAtomImpl(nsStringBuffer* aData, uint32_t aLength,
-                    PLDHashNumber aKeyHash)
-    : AtomImpl(aData, aLength, aKeyHash)
-  {
-  }
-  PermanentAtomImpl() {}
-
-  ~PermanentAtomImpl();
-
-  virtual bool IsPermanent();
 
-  // SizeOfIncludingThis() isn't needed -- the one inherited from AtomImpl is
-  // good enough, because PermanentAtomImpl doesn't add any new data members.
+  // for |#ifdef NS_BUILD_REFCNT_LOGGING| access to reference count
+  nsrefcnt GetRefCount() { return mRefCnt; }
 
-  void* operator new(size_t aSize, AtomImpl* aAtom) CPP_THROW_NEW;
-  void* operator new(size_t aSize) CPP_THROW_NEW
-  {
-    return ::operator new(aSize);
-  }
+  size_t SizeOfIncludingThis(MallocSizeOf aMallocSizeOf);
 
 private:
-  NS_IMETHOD_(MozExternalRefCountType) AddRef();
-  NS_IMETHOD_(MozExternalRefCountType) Release();
+  // Atoms can be addrefed and released on any thread.  Release() only takes
+  // gAtomTableLock when it may drop the last reference, so that a concurrent
+  // lookup (which addrefs under the lock) can't resurrect a dying atom.
+  Atomic<nsrefcnt> mRefCnt;
 };
 
 //----------------------------------------------------------------------
@@ -271,15 +242,13 @@ AtomTableClearEntry(PLDHashTable* aTable, PLDHashEntryHdr* aEntry)
   // Normal |AtomImpl| atoms are deleted when their refcount hits 0, and
   // they then remove themselves from the table.  In other words, they
   // are owned by the callers who own references to them.
-  // |PermanentAtomImpl| permanent atoms ignore their refcount and are
-  // deleted when they are removed from the table at table destruction.
-  // In other words, they are owned by the atom table.
+  // Permanent atoms ignore their refcount and are deleted when they are
+  // removed from the table at table destruction.  In other words, they are
+  // owned by the atom table.
 
   AtomImpl* atom = static_cast<AtomTableEntry*>(aEntry)->mAtom;
   if (atom->IsPermanent()) {
-    // Note that the cast here is important since AtomImpls doesn't have a
-    // virtual dtor.
-    delete static_cast<PermanentAtomImpl*>(atom);
+    atom->DestroyPermanent();
   }
 }
 
@@ -299,27 +268,13 @@ static const PLDHashTableOps AtomTableOps = {
 };
 
 
-static inline
-void
-PromoteToPermanent(AtomImpl* aAtom)
-{
-#ifdef NS_BUILD_REFCNT_LOGGING
-  {
-    nsrefcnt refcount = aAtom->GetRefCount();
-    do {
-      NS_LOG_RELEASE(aAtom, --refcount, "AtomImpl");
-    } while (refcount);
-  }
-#endif
-  aAtom = new (aAtom) PermanentAtomImpl();
-}
-
 void
 NS_PurgeAtomTable()
 {
   delete gStaticAtomTable;
   gStaticAtomTable = nullptr;
 
+  StaticMutexAutoLock lock(gAtomTableLock);
   if (gAtomTable) {
 #ifdef DEBUG
     const char* dumpAtomLeaks = PR_GetEnv("MOZ_DUMP_ATOM_LEAKS");
@@ -392,10 +347,12 @@ AtomImpl::AtomImpl(nsStringBuffer* aStringBuffer, uint32_t aLength,
 AtomImpl::~AtomImpl()
 {
   MOZ_ASSERT(gAtomTable, "uninitialized atom hashtable");
+  // Non-permanent atoms are only destroyed from Release(), which holds
+  // gAtomTableLock; permanent ones are destroyed by NS_PurgeAtomTable().
   // Permanent atoms are removed from the hashtable at shutdown, and we
   // don't want to remove them twice.  See comment above in
   // |AtomTableClearEntry|.
-  if (!IsPermanentInDestructor()) {
+  if (!IsPermanent()) {
     AtomTableKey key(mString, mLength, mHash);
     PL_DHashTableRemove(gAtomTable, &key);
     if (gAtomTable->EntryCount() == 0) {
@@ -407,48 +364,72 @@ AtomImpl::~AtomImpl()
   nsStringBuffer::FromData(mString)->Release();
 }
 
-NS_IMPL_ISUPPORTS(AtomImpl, nsIAtom)
-
-PermanentAtomImpl::~PermanentAtomImpl()
-{
-  // So we can tell if we were permanent while running the base class dtor.
-  mRefCnt = REFCNT_PERMANENT_SENTINEL;
-}
+NS_IMPL_QUERY_INTERFACE(AtomImpl, nsIAtom)
 
 NS_IMETHODIMP_(MozExternalRefCountType)
-PermanentAtomImpl::AddRef()
+AtomImpl::AddRef()
 {
-  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
-  return 2;
+  nsrefcnt count;
+  do {
+    count = mRefCnt;
+    if (count == REFCNT_PERMANENT_SENTINEL) {
+      return 2;
+    }
+    MOZ_ASSERT(int32_t(count) >= 0, "illegal refcnt");
+  } while (!mRefCnt.compareExchange(count, count + 1));
+  NS_LOG_ADDREF(this, count + 1, "AtomImpl", sizeof(*this));
+  return count + 1;
 }
 
 NS_IMETHODIMP_(MozExternalRefCountType)
-PermanentAtomImpl::Release()
-{
-  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
-  return 1;
-}
-
-/* virtual */ bool
-AtomImpl::IsPermanent()
-{
-  return false;
-}
+AtomImpl::Release()
+{
+  // Dropping a reference that isn't the last one doesn't need the lock.
+  nsrefcnt count = mRefCnt;
+  while (count != REFCNT_PERMANENT_SENTINEL && count > 1) {
+    if (mRefCnt.compareExchange(count, count - 1)) {
+      NS_LOG_RELEASE(this, count - 1, "AtomImpl");
+      return count - 1;
+    }
+    count = mRefCnt;
+  }
 
-/* virtual */ bool
-PermanentAtomImpl::IsPermanent()
-{
-  return true;
+  // We may be dropping the last reference.  Lookups addref under the table
+  // lock, so once we hold it nobody else can find this atom and take a new
+  // reference before we've removed it from the table.  Holders of other
+  // references may still addref or release concurrently, so keep using
+  // compare-and-swap.
+  StaticMutexAutoLock lock(gAtomTableLock);
+  do {
+    count = mRefCnt;
+    if (count == REFCNT_PERMANENT_SENTINEL) {
+      return 1;
+    }
+    MOZ_ASSERT(count != 0, "dup release");
+  } while (!mRefCnt.compareExchange(count, count - 1));
+  --count;
+  NS_LOG_RELEASE(this, count, "AtomImpl");
+  if (count == 0) {
+    delete this;
+  }
+  return count;
 }
 
-void*
-PermanentAtomImpl::operator new(size_t aSize, AtomImpl* aAtom) CPP_THROW_NEW
+void
+AtomImpl::MakePermanent()
 {
-  MOZ_ASSERT(!aAtom->IsPermanent(),
-             "converting atom that's already permanent");
+  gAtomTableLock.AssertCurrentThreadOwns();
+  MOZ_ASSERT(!IsPermanent(), "converting atom that's already permanent");
 
-  // Just let the constructor overwrite the vtable pointer.
-  return aAtom;
+  // Concurrent AddRef/Release calls see the sentinel and stop counting.
+  nsrefcnt refcount = mRefCnt.exchange(REFCNT_PERMANENT_SENTINEL);
+#ifdef NS_BUILD_REFCNT_LOGGING
+  while (refcount) {
+    NS_LOG_RELEASE(this, --refcount, "AtomImpl");
+  }
+#else
+  mozilla::unused << refcount;
+#endif
 }
 
 NS_IMETHODIMP
@@ -516,6 +497,7 @@ void
 NS_SizeOfAtomTablesIncludingThis(MallocSizeOf aMallocSizeOf,
                                  size_t* aMain, size_t* aStatic)
 {
+  StaticMutexAutoLock lock(gAtomTableLock);
   *aMain = gAtomTable
          ? PL_DHashTableSizeOfExcludingThis(gAtomTable,
                                             SizeOfAtomTableEntryExcludingThis,
@@ -540,10 +522,12 @@ EnsureTableExists()
   }
 }
 
+// The caller must hold gAtomTableLock, and must keep holding it until it has
+// addrefed or stored the atom in the returned entry.
 static inline AtomTableEntry*
 GetAtomHashEntry(const char* aString, uint32_t aLength, uint32_t* aHashOut)
 {
-  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
+  gAtomTableLock.AssertCurrentThreadOwns();
   EnsureTableExists();
   AtomTableKey key(aString, aLength, aHashOut);
   // This is an infallible add.
@@ -553,7 +537,7 @@ GetAtomHashEntry(const char* aString, uint32_t aLength, uint32_t* aHashOut)
 static inline AtomTableEntry*
 GetAtomHashEntry(const char16_t* aString, uint32_t aLength, uint32_t* aHashOut)
 {
-  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
+  gAtomTableLock.AssertCurrentThreadOwns();
   EnsureTableExists();
   AtomTableKey key(aString, aLength, aHashOut);
   // This is an infallible add.
@@ -581,6 +565,9 @@ class CheckStaticAtomSizes
 nsresult
 RegisterStaticAtoms(const nsStaticAtom* aAtoms, uint32_t aAtomCount)
 {
+  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
+  StaticMutexAutoLock lock(gAtomTableLock);
+
   if (!gStaticAtomTable && !gStaticAtomTableSealed) {
     gStaticAtomTable = new StaticAtomTable();
   }
@@ -602,10 +589,11 @@ RegisterStaticAtoms(const nsStaticAtom* aAtoms, uint32_t aAtomCount)
       if (!atom->IsPermanent()) {
         // We wanted to create a static atom but there is already a non-static
         // atom there. So convert it to a non-refcounting permanent atom.
-        PromoteToPermanent(atom);
+        atom->MakePermanent();
       }
     } else {
-      atom = new PermanentAtomImpl(aAtoms[i].mStringBuffer, stringLen, hash);
+      atom = new AtomImpl(aAtoms[i].mStringBuffer, stringLen, hash);
+      atom->MakePermanent();
       he->mAtom = atom;
     }
     *aAtoms[i].mAtom = atom;
@@ -628,6 +616,7 @@ NS_NewAtom(const char* aUTF8String)
 already_AddRefed<nsIAtom>
 NS_NewAtom(const nsACString& aUTF8String)
 {
+  StaticMutexAutoLock lock(gAtomTableLock);
   uint32_t hash;
   AtomTableEntry* he = GetAtomHashEntry(aUTF8String.Data(),
                                         aUTF8String.Length(),
@@ -660,6 +649,7 @@ NS_NewAtom(const char16_t* aUTF16String)
 already_AddRefed<nsIAtom>
 NS_NewAtom(const nsAString& aUTF16String)
 {
+  StaticMutexAutoLock lock(gAtomTableLock);
   uint32_t hash;
   AtomTableEntry* he = GetAtomHashEntry(aUTF16String.Data(),
                                         aUTF16String.Length(),
@@ -680,6 +670,9 @@ NS_NewAtom(const nsAString& aUTF16String)
 nsIAtom*
 NS_NewPermanentAtom(const nsAString& aUTF16String)
 {
+  // See the comment in RegisterStaticAtoms.
+  MOZ_ASSERT(NS_IsMainThread(), "wrong thread");
+  StaticMutexAutoLock lock(gAtomTableLock);
   uint32_t hash;
   AtomTableEntry* he = GetAtomHashEntry(aUTF16String.Data(),
                                         aUTF16String.Length(),
@@ -688,10 +681,11 @@ NS_NewPermanentAtom(const nsAString& aUTF16String)
   AtomImpl* atom = he->mAtom;
   if (atom) {
     if (!atom->IsPermanent()) {
-      PromoteToPermanent(atom);
+      atom->MakePermanent();
     }
   } else {
-    atom = new PermanentAtomImpl(aUTF16String, hash);
+    atom = new AtomImpl(aUTF16String, hash);
+    atom->MakePermanent();
     he->mAtom = atom;
   }
 
@@ -702,6 +696,7 @@ NS_NewPermanentAtom(const nsAString& aUTF16String)
 nsrefcnt
 NS_GetNumberOfAtoms(void)
 {
+  StaticMutexAutoLock lock(gAtomTableLock);
   MOZ_ASSERT(gAtomTable);
   return gAtomTable->EntryCount();
 }
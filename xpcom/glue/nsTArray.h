@@ -35,6 +35,8 @@ class Heap;
 
 class nsRegion;
 class nsIntRegion;
+template<size_t N> class nsAutoStringN;
+template<size_t N> class nsAutoCStringN;
 namespace mozilla {
 namespace layers {
 struct TileClient;
@@ -693,6 +695,18 @@ struct nsTArray_CopyChooser<mozilla::layers::TileClient>
   typedef nsTArray_CopyWithConstructors<mozilla::layers::TileClient> Type;
 };
 
+template<size_t N>
+struct nsTArray_CopyChooser<nsAutoStringN<N>>
+{
+  typedef nsTArray_CopyWithConstructors<nsAutoStringN<N>> Type;
+};
+
+template<size_t N>
+struct nsTArray_CopyChooser<nsAutoCStringN<N>>
+{
+  typedef nsTArray_CopyWithConstructors<nsAutoCStringN<N>> Type;
+};
+
 
 //
 // Base class for nsTArray_Impl that is templated on element type and derived
@@ -333,6 +333,17 @@ NS_GetCurrentThread()
 {
   return nsThreadManager::get()->GetCurrentThread();
 }
+
+NS_METHOD
+NS_IdleDispatchToCurrentThread(already_AddRefed<nsIRunnable>&& aEvent)
+{
+  nsCOMPtr<nsIRunnable> event(aEvent);
+  nsThread* thread = nsThreadManager::get()->GetCurrentThread();
+  if (!thread) {
+    return NS_ERROR_UNEXPECTED;
+  }
+  return thread->IdleDispatch(event.forget());
+}
 #endif
 
 // nsThreadPoolNaming
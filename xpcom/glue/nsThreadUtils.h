@@ -209,6 +209,25 @@ do_GetMainThread()
 // AddRef it.  Otherwise, you should only consider this pointer valid from code
 // running on the current thread.
 extern nsIThread* NS_GetCurrentThread();
+
+/**
+ * Dispatch the given event to the current thread, to run once the thread has
+ * no other pending event.  Use this for work which is not urgent and should
+ * not compete with the events driving the thread, such as input and painting
+ * on the main thread.
+ *
+ * @param aEvent
+ *   The event to dispatch.
+ *
+ * @returns NS_ERROR_INVALID_ARG
+ *   If event is null.
+ * @returns NS_ERROR_UNEXPECTED
+ *   If there is no nsThread for the current thread (for instance once the
+ *   thread manager has shut down), or if the current thread is shutting down
+ *   and will never run the event.
+ */
+extern NS_METHOD
+NS_IdleDispatchToCurrentThread(already_AddRefed<nsIRunnable>&& aEvent);
 #endif
 
 //-----------------------------------------------------------------------------
@@ -477,6 +477,13 @@ private:
 //       mReadLimit values in play.  The pipe cannot discard old data until
 //       all mReadCursors have moved beyond that point in the stream.
 //
+// NOTE: ReadSegments and WriteSegments hand out pointers straight into the
+//       segments, so callers that use them instead of Read/Write avoid a
+//       copy on that side of the pipe.  The pipe can't adopt a producer's
+//       buffer though: every segment is mBuffer.GetSegmentSize() bytes and
+//       comes from nsSegmentedBuffer, and the cursor arithmetic above
+//       depends on that.
+//
 // NOTE: on some systems (notably OS/2), the heap allocator uses an arena for
 // small allocations (e.g., 64 byte allocations).  this means that buffers may
 // be allocated back-to-back.  in the diagram above, for example, mReadLimit
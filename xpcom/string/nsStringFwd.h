@@ -23,6 +23,7 @@ class nsAString;
 class nsSubstringTuple;
 class nsString;
 class nsAutoString;
+template<size_t N> class nsAutoStringN;
 class nsDependentString;
 class nsDependentSubstring;
 class nsPromiseFlatString;
@@ -39,6 +40,7 @@ class nsACString;
 class nsCSubstringTuple;
 class nsCString;
 class nsAutoCString;
+template<size_t N> class nsAutoCStringN;
 class nsDependentCString;
 class nsDependentCSubstring;
 class nsPromiseFlatCString;
@@ -694,6 +694,94 @@ public:
   }
 };
 
+/**
+ * nsTAutoStringN_CharT
+ *
+ * Like nsTAutoString_CharT, but with an inline buffer of N characters,
+ * including the null terminator, instead of 64.  Small capacities make it
+ * cheap enough to embed in other objects to avoid allocating short strings,
+ * such as header names or class names.
+ *
+ * Unlike nsTAutoString_CharT, it may be used as an nsTArray element, as
+ * nsTArray moves these strings with their copy constructor.
+ *
+ * NAMES:
+ *   nsAutoStringN<N> for wide characters
+ *   nsAutoCStringN<N> for narrow characters
+ */
+template<size_t N>
+class nsTAutoStringN_CharT : public nsTFixedString_CharT
+{
+public:
+
+  typedef nsTAutoStringN_CharT<N> self_type;
+
+public:
+
+  /**
+   * constructors
+   */
+
+  nsTAutoStringN_CharT()
+    : fixed_string_type(mStorage, N, 0)
+  {
+  }
+
+  explicit
+  nsTAutoStringN_CharT(const char_type* aData, size_type aLength = size_type(-1))
+    : fixed_string_type(mStorage, N, 0)
+  {
+    Assign(aData, aLength);
+  }
+
+  nsTAutoStringN_CharT(const self_type& aStr)
+    : fixed_string_type(mStorage, N, 0)
+  {
+    Assign(aStr);
+  }
+
+  explicit
+  nsTAutoStringN_CharT(const substring_type& aStr)
+    : fixed_string_type(mStorage, N, 0)
+  {
+    Assign(aStr);
+  }
+
+  MOZ_IMPLICIT nsTAutoStringN_CharT(const substring_tuple_type& aTuple)
+    : fixed_string_type(mStorage, N, 0)
+  {
+    Assign(aTuple);
+  }
+
+  // |operator=| does not inherit, so we must define our own
+  self_type& operator=(const char_type* aData)
+  {
+    Assign(aData);
+    return *this;
+  }
+  self_type& operator=(const self_type& aStr)
+  {
+    Assign(aStr);
+    return *this;
+  }
+  self_type& operator=(const substring_type& aStr)
+  {
+    Assign(aStr);
+    return *this;
+  }
+  self_type& operator=(const substring_tuple_type& aTuple)
+  {
+    Assign(aTuple);
+    return *this;
+  }
+
+private:
+
+  static_assert(N > 1, "the inline buffer must fit at least one character");
+
+  char_type mStorage[N];
+};
+
 /**
  * nsTXPIDLString extends nsTString such that:
  *
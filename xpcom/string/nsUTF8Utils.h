@@ -301,6 +301,13 @@ public:
       return;
     }
 
+#if defined(MOZILLA_INTERNAL_API) && defined(MOZILLA_MAY_SUPPORT_SSE2)
+    if (mozilla::supports_sse2()) {
+      write_sse2(aStart, aN);
+      return;
+    }
+#endif
+
     // algorithm assumes utf8 units won't
     // be spread across fragments
     const value_type* p = aStart;
@@ -326,6 +333,11 @@ public:
     mBuffer = out;
   }
 
+#if defined(MOZILLA_INTERNAL_API) && defined(MOZILLA_MAY_SUPPORT_SSE2)
+  // Same as write, with runs of ASCII characters converted 16 at a time.
+  void write_sse2(const value_type* aStart, uint32_t aN);
+#endif
+
   void write_terminator()
   {
     *mBuffer = buffer_type(0);
@@ -367,6 +379,12 @@ public:
     // be spread across fragments
     const value_type* p = aStart;
     const value_type* end = aStart + aN;
+#if defined(MOZILLA_INTERNAL_API) && defined(MOZILLA_MAY_SUPPORT_SSE2)
+    if (mozilla::supports_sse2()) {
+      p += CountLeadingASCII_sse2(aStart, aN);
+      mLength += p - aStart;
+    }
+#endif
     for (; p < end /* && *p */; ++mLength) {
       if (UTF8traits::isASCII(*p)) {
         p += 1;
@@ -433,6 +451,12 @@ public:
     }
   }
 
+#if defined(MOZILLA_INTERNAL_API) && defined(MOZILLA_MAY_SUPPORT_SSE2)
+  // Returns the length of the leading run of ASCII characters of aStart,
+  // rounded down to a multiple of 16.
+  static uint32_t CountLeadingASCII_sse2(const value_type* aStart, uint32_t aN);
+#endif
+
 private:
   size_t mLength;
   bool mErrorEncountered;
@@ -103,3 +103,63 @@ LossyConvertEncoding8to16::write_sse2(const char* aSource,
 
   mDestination += i;
 }
+
+// Returns true if none of the 16 bytes at aSource has its high bit set.
+static inline bool
+IsASCII16(const char* aSource)
+{
+  __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(aSource));
+  return _mm_movemask_epi8(source) == 0;
+}
+
+uint32_t
+CalculateUTF8Length::CountLeadingASCII_sse2(const char* aStart, uint32_t aN)
+{
+  uint32_t i = 0;
+  for (; aN - i > 15 && IsASCII16(aStart + i); i += 16) {
+  }
+  return i;
+}
+
+void
+ConvertUTF8toUTF16::write_sse2(const char* aStart, uint32_t aN)
+{
+  const char* p = aStart;
+  const char* end = aStart + aN;
+  char16_t* out = mBuffer;
+
+  while (p != end) {
+    // Widen runs of 16 ASCII characters at once, as
+    // LossyConvertEncoding8to16 does.  Text which is mostly ASCII, like
+    // markup and JSON, spends most of its time here.
+    if (end - p > 15) {
+      __m128i source = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+      if (_mm_movemask_epi8(source) == 0) {
+        __m128i lo = _mm_unpacklo_epi8(source, _mm_setzero_si128());
+        __m128i hi = _mm_unpackhi_epi8(source, _mm_setzero_si128());
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out),     lo);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 8), hi);
+        p += 16;
+        out += 16;
+        continue;
+      }
+    }
+
+    bool err;
+    uint32_t ucs4 = UTF8CharEnumerator::NextChar(&p, end, &err);
+
+    if (err) {
+      mErrorEncountered = true;
+      mBuffer = out;
+      return;
+    }
+
+    if (ucs4 >= PLANE1_BASE) {
+      *out++ = (char16_t)H_SURROGATE(ucs4);
+      *out++ = (char16_t)L_SURROGATE(ucs4);
+    } else {
+      *out++ = ucs4;
+    }
+  }
+  mBuffer = out;
+}
@@ -11,6 +11,7 @@
 #define nsTString_CharT                     nsCString
 #define nsTFixedString_CharT                nsFixedCString
 #define nsTAutoString_CharT                 nsAutoCString
+#define nsTAutoStringN_CharT                nsAutoCStringN
 #define nsTSubstring_CharT                  nsACString
 #define nsTSubstringTuple_CharT             nsCSubstringTuple
 #define nsTStringComparator_CharT           nsCStringComparator
@@ -11,6 +11,7 @@
 #define nsTString_CharT                     nsString
 #define nsTFixedString_CharT                nsFixedString
 #define nsTAutoString_CharT                 nsAutoString
+#define nsTAutoStringN_CharT                nsAutoStringN
 #define nsTSubstring_CharT                  nsAString
 #define nsTSubstringTuple_CharT             nsSubstringTuple
 #define nsTStringComparator_CharT           nsStringComparator
@@ -12,6 +12,7 @@
 #undef nsTString_CharT
 #undef nsTFixedString_CharT
 #undef nsTAutoString_CharT
+#undef nsTAutoStringN_CharT
 #undef nsTSubstring_CharT
 #undef nsTSubstringTuple_CharT
 #undef nsTStringComparator_CharT
@@ -0,0 +1,113 @@
+/* -*- Mode: C++; tab-width: 8; indent-tabs-mode: nil; c-basic-offset: 2 -*- */
+/* vim: set ts=8 sts=2 et sw=2 tw=80: */
+/* This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
+
+#include "mozilla/Atomics.h"
+#include "nsCOMPtr.h"
+#include "nsIAtom.h"
+#include "nspr.h"
+#include "nsStaticAtom.h"
+#include "nsString.h"
+#include "nsThreadUtils.h"
+#include "gtest/gtest.h"
+
+using namespace mozilla;
+
+namespace TestAtoms {
+
+#define RACE_ATOMS \
+  RACE_ATOM(race0, "gtest-atom-race-0") \
+  RACE_ATOM(race1, "gtest-atom-race-1") \
+  RACE_ATOM(race2, "gtest-atom-race-2") \
+  RACE_ATOM(race3, "gtest-atom-race-3")
+
+#define RACE_ATOM(name_, value_) static nsIAtom* name_;
+RACE_ATOMS
+#undef RACE_ATOM
+
+#define RACE_ATOM(name_, value_) NS_STATIC_ATOM_BUFFER(name_##_buffer, value_)
+RACE_ATOMS
+#undef RACE_ATOM
+
+static const nsStaticAtom sRaceAtoms[] = {
+#define RACE_ATOM(name_, value_) NS_STATIC_ATOM(name_##_buffer, &name_),
+RACE_ATOMS
+#undef RACE_ATOM
+};
+
+static const char* const sRaceStrings[] = {
+#define RACE_ATOM(name_, value_) value_,
+RACE_ATOMS
+#undef RACE_ATOM
+};
+
+static const uint32_t kRaceIterations = 20000;
+
+// Atomizes and releases the strings of sRaceAtoms over and over, so that the
+// main thread's registration finds dynamic atoms that other threads are
+// addrefing and releasing at the same time.
+class AtomizeRunnable final : public nsRunnable
+{
+public:
+  explicit AtomizeRunnable(Atomic<bool>& aStarted)
+    : mStarted(aStarted)
+  {
+  }
+
+  NS_IMETHOD Run() override
+  {
+    for (uint32_t i = 0; i < kRaceIterations; ++i) {
+      for (size_t j = 0; j < ArrayLength(sRaceStrings); ++j) {
+        nsCOMPtr<nsIAtom> atom = do_GetAtom(sRaceStrings[j]);
+        EXPECT_TRUE(atom);
+        nsCOMPtr<nsIAtom> again = atom;
+        EXPECT_TRUE(atom->EqualsUTF8(nsDependentCString(sRaceStrings[j])));
+      }
+      mStarted = true;
+    }
+    return NS_OK;
+  }
+
+private:
+  Atomic<bool>& mStarted;
+};
+
+TEST(Atoms, ConcurrentRegisterStaticAtoms)
+{
+  static const uint32_t kThreadCount = 4;
+
+  Atomic<bool> started[kThreadCount];
+  nsCOMPtr<nsIThread> threads[kThreadCount];
+  for (uint32_t i = 0; i < kThreadCount; ++i) {
+    nsCOMPtr<nsIRunnable> runnable = new AtomizeRunnable(started[i]);
+    nsresult rv = NS_NewThread(getter_AddRefs(threads[i]), runnable);
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+  }
+
+  // Make sure every thread holds dynamic atoms for the strings before they
+  // become permanent.
+  for (uint32_t i = 0; i < kThreadCount; ++i) {
+    while (!started[i]) {
+      PR_Sleep(PR_MillisecondsToInterval(1));
+    }
+  }
+
+  nsresult rv = NS_RegisterStaticAtoms(sRaceAtoms);
+  EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+  for (uint32_t i = 0; i < kThreadCount; ++i) {
+    threads[i]->Shutdown();
+  }
+
+  for (size_t i = 0; i < ArrayLength(sRaceAtoms); ++i) {
+    nsIAtom* atom = *sRaceAtoms[i].mAtom;
+    ASSERT_TRUE(atom);
+    EXPECT_TRUE(atom->IsStaticAtom());
+    nsCOMPtr<nsIAtom> lookup = do_GetAtom(sRaceStrings[i]);
+    EXPECT_EQ(atom, lookup.get());
+  }
+}
+
+} // namespace TestAtoms
@@ -730,6 +730,34 @@ TEST(Strings, voided_autostr)
   EXPECT_STREQ(str.get(), kData);
 }
 
+TEST(Strings, autostrn)
+{
+  const char kShort[] = "class";
+  const char kLong[] = "a string which does not fit inline";
+
+  nsAutoCStringN<16> str(kShort);
+  EXPECT_STREQ(str.get(), kShort);
+
+  str.Assign(kLong);
+  EXPECT_STREQ(str.get(), kLong);
+
+  str.Assign(kShort);
+  EXPECT_STREQ(str.get(), kShort);
+
+  // Growing the array moves the strings, which must keep pointing to their
+  // own inline buffers.
+  nsTArray<nsAutoCStringN<16>> array;
+  for (uint32_t i = 0; i < 100; i++) {
+    nsAutoCStringN<16>* elem = array.AppendElement();
+    elem->AppendInt(i);
+  }
+  for (uint32_t i = 0; i < 100; i++) {
+    nsAutoCString expected;
+    expected.AppendInt(i);
+    EXPECT_TRUE(array[i].Equals(expected));
+  }
+}
+
 TEST(Strings, voided_assignment)
 {
   nsCString a, b;
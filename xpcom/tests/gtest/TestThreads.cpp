@@ -5,6 +5,10 @@
  * file, You can obtain one at http://mozilla.org/MPL/2.0/. */
 
 #include "nsThreadUtils.h"
+#include "nsIThreadInternal.h"
+#include "mozilla/Atomics.h"
+#include "mozilla/Monitor.h"
+#include "nsTArray.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include "nspr.h"
@@ -162,3 +166,176 @@ TEST(Threads, StressNSPR)
         delete [] array;
     }
 }
+
+template<typename Function>
+static nsresult
+IdleDispatchFunction(const Function& aFunction)
+{
+    nsCOMPtr<nsIRunnable> event = NS_NewRunnableFunction(aFunction);
+    return NS_IdleDispatchToCurrentThread(event.forget());
+}
+
+template<typename Function>
+static nsresult
+DispatchFunction(const Function& aFunction)
+{
+    nsCOMPtr<nsIRunnable> event = NS_NewRunnableFunction(aFunction);
+    return NS_DispatchToCurrentThread(event);
+}
+
+TEST(Threads, IdleDispatchOrdering)
+{
+    nsCOMPtr<nsIThread> thread;
+    nsresult rv = NS_NewThread(getter_AddRefs(thread));
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    // Only touched on |thread| until it has been shut down.
+    nsTArray<int> order;
+
+    nsCOMPtr<nsIRunnable> event = NS_NewRunnableFunction([&order]() {
+        // Idle events run after all normal events, even those dispatched
+        // later, and in the order they were dispatched themselves.
+        EXPECT_TRUE(NS_SUCCEEDED(IdleDispatchFunction([&order]() {
+            order.AppendElement(3);
+        })));
+        EXPECT_TRUE(NS_SUCCEEDED(DispatchFunction([&order]() {
+            order.AppendElement(1);
+        })));
+        EXPECT_TRUE(NS_SUCCEEDED(IdleDispatchFunction([&order]() {
+            order.AppendElement(4);
+        })));
+        EXPECT_TRUE(NS_SUCCEEDED(DispatchFunction([&order]() {
+            order.AppendElement(2);
+        })));
+    });
+    rv = thread->Dispatch(event, NS_DISPATCH_NORMAL);
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    rv = thread->Shutdown();
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    ASSERT_EQ(4u, order.Length());
+    for (uint32_t i = 0; i < order.Length(); i++) {
+        EXPECT_EQ(int(i + 1), order[i]);
+    }
+}
+
+TEST(Threads, IdleDispatchNestedEventLoop)
+{
+    nsCOMPtr<nsIThread> thread;
+    nsresult rv = NS_NewThread(getter_AddRefs(thread));
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    nsTArray<int> order;
+
+    nsCOMPtr<nsIRunnable> event = NS_NewRunnableFunction([&order]() {
+        EXPECT_TRUE(NS_SUCCEEDED(IdleDispatchFunction([&order]() {
+            order.AppendElement(2);
+        })));
+        EXPECT_TRUE(NS_SUCCEEDED(DispatchFunction([&order]() {
+            order.AppendElement(1);
+        })));
+
+        // A nested event loop on the thread's own event queue runs idle
+        // events too, still after the normal ones.
+        while (order.Length() < 2) {
+            NS_ProcessNextEvent(nullptr, true);
+        }
+        order.AppendElement(3);
+    });
+    rv = thread->Dispatch(event, NS_DISPATCH_NORMAL);
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    rv = thread->Shutdown();
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    ASSERT_EQ(3u, order.Length());
+    for (uint32_t i = 0; i < order.Length(); i++) {
+        EXPECT_EQ(int(i + 1), order[i]);
+    }
+}
+
+// Counts the events dispatched to the thread it observes.
+class DispatchCounter final : public nsIThreadObserver {
+  ~DispatchCounter() {}
+public:
+    NS_DECL_THREADSAFE_ISUPPORTS
+    NS_DECL_NSITHREADOBSERVER
+
+    DispatchCounter()
+      : mMonitor("DispatchCounter.mMonitor")
+      , mCount(0)
+    {}
+
+    void WaitForDispatches(uint32_t aCount) {
+        mozilla::MonitorAutoLock mon(mMonitor);
+        while (mCount < aCount) {
+            mon.Wait();
+        }
+    }
+
+private:
+    mozilla::Monitor mMonitor;
+    uint32_t mCount;
+};
+
+NS_IMPL_ISUPPORTS(DispatchCounter, nsIThreadObserver)
+
+NS_IMETHODIMP
+DispatchCounter::OnDispatchedEvent(nsIThreadInternal* aThread)
+{
+    mozilla::MonitorAutoLock mon(mMonitor);
+    ++mCount;
+    mon.Notify();
+    return NS_OK;
+}
+
+NS_IMETHODIMP
+DispatchCounter::OnProcessNextEvent(nsIThreadInternal* aThread, bool aMayWait,
+                                    uint32_t aRecursionDepth)
+{
+    return NS_OK;
+}
+
+NS_IMETHODIMP
+DispatchCounter::AfterProcessNextEvent(nsIThreadInternal* aThread,
+                                       uint32_t aRecursionDepth,
+                                       bool aEventWasProcessed)
+{
+    return NS_OK;
+}
+
+TEST(Threads, IdleDispatchShutdownDrain)
+{
+    nsCOMPtr<nsIThread> thread;
+    nsresult rv = NS_NewThread(getter_AddRefs(thread));
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    nsRefPtr<DispatchCounter> counter = new DispatchCounter();
+    mozilla::Atomic<bool> ranIdle(false);
+
+    nsCOMPtr<nsIRunnable> event =
+        NS_NewRunnableFunction([counter, &ranIdle]() {
+            nsCOMPtr<nsIThreadInternal> current =
+                do_QueryInterface(NS_GetCurrentThread());
+            EXPECT_TRUE(NS_SUCCEEDED(current->SetObserver(counter)));
+
+            EXPECT_TRUE(NS_SUCCEEDED(IdleDispatchFunction([&ranIdle]() {
+                ranIdle = true;
+            })));
+
+            // The idle event was the first dispatch; the second one is the
+            // shutdown event.  Keep the thread busy until it has arrived, so
+            // that the idle event is still pending when the shutdown event
+            // runs, and has to be run by the final drain.
+            counter->WaitForDispatches(2);
+            EXPECT_TRUE(NS_SUCCEEDED(current->SetObserver(nullptr)));
+        });
+    rv = thread->Dispatch(event, NS_DISPATCH_NORMAL);
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    rv = thread->Shutdown();
+    EXPECT_TRUE(NS_SUCCEEDED(rv));
+
+    EXPECT_TRUE(ranIdle);
+}
@@ -31,7 +31,8 @@ TimerThread::TimerThread() :
   mWaiting(false),
   mNotified(false),
   mSleeping(false),
-  mLastTimerEventLoopRun(TimeStamp::Now())
+  mLastTimerEventLoopRun(TimeStamp::Now()),
+  mTimerSequence(0)
 {
 }
 
@@ -155,7 +156,9 @@ TimerThread::Shutdown()
     // might potentially call some code reentering the same lock
     // that leads to unexpected behavior or deadlock.
     // See bug 422472.
-    timers.AppendElements(mTimers);
+    for (uint32_t i = 0; i < mTimers.Length(); i++) {
+      timers.AppendElement(mTimers[i].mTimer);
+    }
     mTimers.Clear();
   }
 
@@ -247,7 +250,7 @@ TimerThread::Run()
       nsTimerImpl* timer = nullptr;
 
       if (!mTimers.IsEmpty()) {
-        timer = mTimers[0];
+        timer = mTimers[0].mTimer;
 
         if (now >= timer->mTimeout || forceRunThisTimer) {
     next:
@@ -307,7 +310,7 @@ TimerThread::Run()
       }
 
       if (!mTimers.IsEmpty()) {
-        timer = mTimers[0];
+        timer = mTimers[0].mTimer;
 
         TimeStamp timeout = timer->mTimeout;
 
@@ -444,12 +447,16 @@ TimerThread::AddTimerInternal(nsTimerImpl* aTimer)
 
   TimeStamp now = TimeStamp::Now();
 
-  TimerAdditionComparator c(now, aTimer);
-  nsTimerImpl** insertSlot = mTimers.InsertElementSorted(aTimer, c);
+  TimerEntry entry;
+  entry.mKey = aTimer->mTimeout < now ? now : aTimer->mTimeout;
+  entry.mSequence = mTimerSequence++;
+  entry.mTimer = aTimer;
 
-  if (!insertSlot) {
+  if (!mTimers.AppendElement(entry)) {
     return -1;
   }
+  aTimer->mHeapIndex = mTimers.Length() - 1;
+  size_t index = SiftUp(aTimer->mHeapIndex);
 
   aTimer->mArmed = true;
   NS_ADDREF(aTimer);
@@ -460,21 +467,82 @@ TimerThread::AddTimerInternal(nsTimerImpl* aTimer)
   aTimer->GetTLSTraceInfo();
 #endif
 
-  return insertSlot - mTimers.Elements();
+  return index;
 }
 
 bool
 TimerThread::RemoveTimerInternal(nsTimerImpl* aTimer)
 {
   mMonitor.AssertCurrentThreadOwns();
-  if (!mTimers.RemoveElement(aTimer)) {
+
+  // The timer might already have been removed, in which case mHeapIndex is
+  // stale and might be out of bounds or refer to another timer.
+  size_t index = aTimer->mHeapIndex;
+  if (index >= mTimers.Length() || mTimers[index].mTimer != aTimer) {
     return false;
   }
 
+  // Move the last entry into the hole and restore the heap invariant.
+  size_t last = mTimers.Length() - 1;
+  if (index != last) {
+    SetEntry(index, mTimers[last]);
+    mTimers.RemoveElementAt(last);
+    SiftDown(SiftUp(index));
+  } else {
+    mTimers.RemoveElementAt(last);
+  }
+
   ReleaseTimerInternal(aTimer);
   return true;
 }
 
+void
+TimerThread::SetEntry(size_t aIndex, const TimerEntry& aEntry)
+{
+  mTimers[aIndex] = aEntry;
+  aEntry.mTimer->mHeapIndex = aIndex;
+}
+
+size_t
+TimerThread::SiftUp(size_t aIndex)
+{
+  mMonitor.AssertCurrentThreadOwns();
+  TimerEntry entry = mTimers[aIndex];
+  while (aIndex > 0) {
+    size_t parent = (aIndex - 1) / 2;
+    if (!entry.LessThan(mTimers[parent])) {
+      break;
+    }
+    SetEntry(aIndex, mTimers[parent]);
+    aIndex = parent;
+  }
+  SetEntry(aIndex, entry);
+  return aIndex;
+}
+
+void
+TimerThread::SiftDown(size_t aIndex)
+{
+  mMonitor.AssertCurrentThreadOwns();
+  size_t length = mTimers.Length();
+  TimerEntry entry = mTimers[aIndex];
+  while (true) {
+    size_t child = 2 * aIndex + 1;
+    if (child >= length) {
+      break;
+    }
+    if (child + 1 < length && mTimers[child + 1].LessThan(mTimers[child])) {
+      child++;
+    }
+    if (!mTimers[child].LessThan(entry)) {
+      break;
+    }
+    SetEntry(aIndex, mTimers[child]);
+    aIndex = child;
+  }
+  SetEntry(aIndex, entry);
+}
+
 void
 TimerThread::ReleaseTimerInternal(nsTimerImpl* aTimer)
 {
@@ -515,8 +583,9 @@ TimerThread::DoAfterSleep()
   // timers retain the exact same order (and relative times) as before
   // going to sleep.
   for (uint32_t i = 0; i < mTimers.Length(); i ++) {
-    nsTimerImpl* timer = mTimers[i];
+    nsTimerImpl* timer = mTimers[i].mTimer;
     timer->mTimeout += slept;
+    mTimers[i].mKey += slept;
   }
   mSleeping = false;
   mLastTimerEventLoopRun = now;
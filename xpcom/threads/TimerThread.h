@@ -24,6 +24,26 @@ namespace mozilla {
 class TimeStamp;
 } // namespace mozilla
 
+// An element of the TimerThread heap.
+struct TimerEntry
+{
+  // Timers are ordered by their timeout, clamped to the time at which they
+  // were added: a timer which is already overdue when it is added fires after
+  // all the timers which were overdue before it, as events posted at the same
+  // time would.  Timers with the same key fire in the order they were added.
+  mozilla::TimeStamp mKey;
+  uint64_t mSequence;
+  nsTimerImpl* mTimer;
+
+  bool LessThan(const TimerEntry& aOther) const
+  {
+    if (mKey != aOther.mKey) {
+      return mKey < aOther.mKey;
+    }
+    return mSequence < aOther.mSequence;
+  }
+};
+
 class TimerThread final
   : public nsIRunnable
   , public nsIObserver
@@ -63,11 +83,17 @@ private:
 
   // These two internal helper methods must be called while mMonitor is held.
   // AddTimerInternal returns the position where the timer was added in the
-  // list, or -1 if it failed.
+  // heap, or -1 if it failed.
   int32_t AddTimerInternal(nsTimerImpl* aTimer);
   bool    RemoveTimerInternal(nsTimerImpl* aTimer);
   void    ReleaseTimerInternal(nsTimerImpl* aTimer);
 
+  // Heap maintenance helpers, called while mMonitor is held.  They keep
+  // nsTimerImpl::mHeapIndex in sync with the position of each timer.
+  size_t  SiftUp(size_t aIndex);
+  void    SiftDown(size_t aIndex);
+  void    SetEntry(size_t aIndex, const TimerEntry& aEntry);
+
   nsCOMPtr<nsIThread> mThread;
   Monitor mMonitor;
 
@@ -77,39 +103,13 @@ private:
   bool mSleeping;
   TimeStamp mLastTimerEventLoopRun;
 
-  nsTArray<nsTimerImpl*> mTimers;
-};
+  // Binary min-heap of the armed timers, so that adding, cancelling and firing
+  // a timer costs O(log n).  mTimers[0] is always the next timer to fire.
+  nsTArray<TimerEntry> mTimers;
 
-struct TimerAdditionComparator
-{
-  TimerAdditionComparator(const mozilla::TimeStamp& aNow,
-                          nsTimerImpl* aTimerToInsert) :
-    now(aNow)
-#ifdef DEBUG
-    , timerToInsert(aTimerToInsert)
-#endif
-  {
-  }
-
-  bool LessThan(nsTimerImpl* aFromArray, nsTimerImpl* aNewTimer) const
-  {
-    MOZ_ASSERT(aNewTimer == timerToInsert, "Unexpected timer ordering");
-
-    // Skip any overdue timers.
-    return aFromArray->mTimeout <= now ||
-           aFromArray->mTimeout <= aNewTimer->mTimeout;
-  }
-
-  bool Equals(nsTimerImpl* aFromArray, nsTimerImpl* aNewTimer) const
-  {
-    return false;
-  }
-
-private:
-  const mozilla::TimeStamp& now;
-#ifdef DEBUG
-  const nsTimerImpl* const timerToInsert;
-#endif
+  // Incremented for each added timer, to fire timers with the same deadline
+  // in the order they were added.
+  uint64_t mTimerSequence;
 };
 
 #endif /* TimerThread_h___ */
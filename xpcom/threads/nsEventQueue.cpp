@@ -123,8 +123,11 @@ nsEventQueue::PutEvent(already_AddRefed<nsIRunnable>&& aRunnable)
 
   event.swap(mTail->mEvents[mOffsetTail]);
   ++mOffsetTail;
+  // Each event can only be taken by a single consumer, so wake up one waiter
+  // rather than every idle thread of a pool sharing this queue.  Changes to
+  // anything else waiters depend on are always signaled with NotifyAll.
   LOG(("EVENTQ(%p): notify\n", this));
-  mon.NotifyAll();
+  mon.Notify();
 }
 
 size_t
@@ -370,7 +370,8 @@ nsThread::ThreadFunc(void* aArg)
     while (true) {
       {
         MutexAutoLock lock(self->mLock);
-        if (!self->mEvents->HasPendingEvent()) {
+        if (!self->mEvents->HasPendingEvent() &&
+            !self->mIdleEvents.HasPendingEvent()) {
           // No events in the queue, so we will stop now. Don't let any more
           // events be added, since they won't be processed. It is critical
           // that no PutEvent can occur between testing that the event queue is
@@ -536,6 +537,38 @@ nsThread::PutEvent(already_AddRefed<nsIRunnable>&& aEvent, nsNestedEventTarget*
   return NS_OK;
 }
 
+nsresult
+nsThread::IdleDispatch(already_AddRefed<nsIRunnable>&& aEvent)
+{
+  nsCOMPtr<nsIRunnable> event(aEvent);
+  if (NS_WARN_IF(!event)) {
+    return NS_ERROR_INVALID_ARG;
+  }
+
+  if (NS_WARN_IF(PR_GetCurrentThread() != mThread)) {
+    return NS_ERROR_NOT_SAME_THREAD;
+  }
+
+  nsCOMPtr<nsIThreadObserver> obs;
+  {
+    MutexAutoLock lock(mLock);
+    if (mEventsAreDoomed) {
+      NS_WARNING("An event was posted to a thread that will never run it (rejected)");
+      return NS_ERROR_UNEXPECTED;
+    }
+    mIdleEvents.PutEvent(event.forget());
+    obs = mObserver;
+  }
+
+  // The observer may need to wake up a native event loop for the idle event
+  // to be processed at all.
+  if (obs) {
+    obs->OnDispatchedEvent(this);
+  }
+
+  return NS_OK;
+}
+
 nsresult
 nsThread::DispatchInternal(already_AddRefed<nsIRunnable>&& aEvent, uint32_t aFlags,
                            nsNestedEventTarget* aTarget)
@@ -692,7 +725,8 @@ nsThread::HasPendingEvents(bool* aResult)
     return NS_ERROR_NOT_SAME_THREAD;
   }
 
-  *aResult = mEvents->GetEvent(false, nullptr);
+  *aResult = mEvents->GetEvent(false, nullptr) ||
+             (mEvents == &mEventsRoot && mIdleEvents.HasPendingEvent());
   return NS_OK;
 }
 
@@ -853,7 +887,17 @@ nsThread::ProcessNextEvent(bool aMayWait, bool* aResult)
 
     // If we are shutting down, then do not wait for new events.
     nsCOMPtr<nsIRunnable> event;
-    mEvents->GetEvent(reallyWait, getter_AddRefs(event));
+    mEvents->GetEvent(false, getter_AddRefs(event));
+
+    // Idle events only run when no other event is pending, and not from
+    // nested event queues which are waiting for specific events.
+    if (!event && mEvents == &mEventsRoot) {
+      mIdleEvents.GetPendingEvent(getter_AddRefs(event));
+    }
+
+    if (!event && reallyWait) {
+      mEvents->GetEvent(true, getter_AddRefs(event));
+    }
 
     *aResult = (event.get() != nullptr);
 
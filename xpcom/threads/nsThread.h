@@ -70,6 +70,11 @@ public:
   static nsresult
   SetMainThreadObserver(nsIThreadObserver* aObserver);
 
+  // Dispatch an event which only runs once this thread has no other pending
+  // event.  Idle events run in the order they were dispatched.  This must be
+  // called on the thread itself.
+  nsresult IdleDispatch(already_AddRefed<nsIRunnable>&& aEvent);
+
 protected:
   static nsIThreadObserver* sMainThreadObserver;
 
@@ -182,6 +187,9 @@ protected:
   nsChainedEventQueue* mEvents;  // never null
   nsChainedEventQueue  mEventsRoot;
 
+  // Events dispatched with IdleDispatch.  Only accessed on the thread itself.
+  nsEventQueue mIdleEvents;
+
   int32_t   mPriority;
   PRThread* mThread;
   uint32_t  mNestedEventLoopDepth;
@@ -42,7 +42,6 @@ public:
   static void Shutdown();
 
   friend class TimerThread;
-  friend struct TimerAdditionComparator;
   friend class nsTimerEvent;
 
   NS_DECL_THREADSAFE_ISUPPORTS
@@ -150,6 +149,10 @@ private:
   uint32_t              mDelay;
   TimeStamp             mTimeout;
 
+  // Position of this timer in the TimerThread heap while it is armed, only
+  // accessed under the protection of TimerThread::mMonitor.
+  uint32_t              mHeapIndex;
+
 #ifdef MOZ_TASK_TRACER
   mozilla::tasktracer::TracedTaskCommon mTracedTask;
 #endif